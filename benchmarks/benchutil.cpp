@@ -0,0 +1,70 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchutil.h"
+
+#include "inputdevice.h"
+#include "joybuttonslot.h"
+#include "joysensordirection.h"
+#include "joysensortype.h"
+#include "setjoystick.h"
+
+#include <SDL2/SDL.h>
+
+#include <QString>
+
+/**
+ * @brief Registers the meta types main() of the application registers.
+ */
+void BenchUtil::registerMetaTypes()
+{
+    qRegisterMetaType<JoyButtonSlot *>();
+    qRegisterMetaType<SetJoystick *>();
+    qRegisterMetaType<InputDevice *>();
+    qRegisterMetaType<SDL_JoystickID>("SDL_JoystickID");
+    qRegisterMetaType<JoyButtonSlot::JoySlotInputAction>("JoyButtonSlot::JoySlotInputAction");
+    qRegisterMetaType<JoySensorType>();
+    qRegisterMetaType<JoySensorDirection>();
+}
+
+/**
+ * @brief Attaches a virtual SDL joystick with a game controller mapping.
+ * @returns SDL device index or -1 on failure.
+ */
+int BenchUtil::attachVirtualController()
+{
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+    int index = SDL_JoystickAttachVirtual(SDL_JOYSTICK_TYPE_GAMECONTROLLER, BENCH_AXES, BENCH_BUTTONS, 0);
+
+    if (index < 0)
+        return -1;
+
+    char guid[33] = {0};
+    SDL_JoystickGetGUIDString(SDL_JoystickGetDeviceGUID(index), guid, sizeof(guid));
+
+    QString mapping = QString("%1,antimicrox bench controller,a:b0,b:b1,x:b2,y:b3,back:b4,guide:b5,start:b6,"
+                              "leftstick:b7,rightstick:b8,leftshoulder:b9,rightshoulder:b10,dpup:b11,dpdown:b12,"
+                              "dpleft:b13,dpright:b14,leftx:a0,lefty:a1,rightx:a2,righty:a3,lefttrigger:a4,"
+                              "righttrigger:a5,")
+                          .arg(QString(guid));
+    SDL_GameControllerAddMapping(mapping.toUtf8().constData());
+
+    return index;
+#else
+    return -1;
+#endif
+}
@@ -0,0 +1,35 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <SDL2/SDL_gamecontroller.h>
+
+/**
+ * @file benchutil.h
+ * @brief Helpers shared by the headless benchmark and fuzzing targets.
+ */
+
+namespace BenchUtil {
+
+const int BENCH_AXES = SDL_CONTROLLER_AXIS_MAX;
+const int BENCH_BUTTONS = 15;
+
+void registerMetaTypes();
+int attachVirtualController();
+
+} // namespace BenchUtil
@@ -0,0 +1,348 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file mappingbench.cpp
+ * @brief Headless benchmark of the mapping engine.
+ *
+ * A virtual SDL game controller is attached and picked up by a non-graphical
+ * InputDaemon. The controller gets a profile loaded through XMLConfigReader
+ * (or a built-in mapping) and a deterministic synthetic session is replayed
+ * through InputDaemon::secondInputPass. Generated output goes to the null
+ * event generator, so neither an X server nor /dev/uinput is needed.
+ */
+
+#include "benchutil.h"
+
+#include "antimicrosettings.h"
+#include "antkeymapper.h"
+#include "common.h"
+#include "eventhandlerfactory.h"
+#include "eventhandlers/nulleventhandler.h"
+#include "inputdaemon.h"
+#include "inputdevice.h"
+#include "joybuttonslot.h"
+#include "joybuttontypes/joybutton.h"
+#include "joycontrolstick.h"
+#include "latencytracer.h"
+#include "logger.h"
+#include "sdleventplayer.h"
+#include "sdleventring.h"
+#include "setjoystick.h"
+#include "xmlconfigreader.h"
+
+#include <SDL2/SDL.h>
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QTemporaryDir>
+#include <QTextStream>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+static std::atomic<quint64> allocationCount(0);
+
+void *operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (void *pointer = std::malloc(size ? size : 1))
+        return pointer;
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+
+void operator delete(void *pointer, std::size_t) noexcept { std::free(pointer); }
+
+/**
+ * @brief Gives the benchmark access to the dispatch pass of InputDaemon.
+ */
+class BenchInputDaemon : public InputDaemon
+{
+  public:
+    BenchInputDaemon(QMap<SDL_JoystickID, InputDevice *> *joysticks, AntiMicroSettings *settings)
+        : InputDaemon(joysticks, settings, false)
+    {
+    }
+
+    void dispatch(SDLEventRing *ring) { secondInputPass(ring); }
+};
+
+/**
+ * @brief Mapping used when no profile is given: face and shoulder buttons
+ *  type keys, the left stick types WASD-like keys and the right stick moves
+ *  the mouse.
+ */
+static void assignDefaultMapping(InputDevice *device)
+{
+    SetJoystick *set = device->getActiveSetJoystick();
+
+    for (int i = 0; i < set->getNumberButtons(); i++)
+    {
+        JoyButton *button = set->getJoyButton(i);
+
+        if (button != nullptr)
+            button->setAssignedSlot(Qt::Key_A + i, JoyButtonSlot::JoyKeyboard);
+    }
+
+    JoyControlStick *leftStick = set->getJoyStick(0);
+    JoyControlStick *rightStick = set->getJoyStick(1);
+
+    if (leftStick != nullptr)
+    {
+        leftStick->getDirectionButton(JoyControlStick::StickUp)->setAssignedSlot(Qt::Key_W, JoyButtonSlot::JoyKeyboard);
+        leftStick->getDirectionButton(JoyControlStick::StickDown)->setAssignedSlot(Qt::Key_S, JoyButtonSlot::JoyKeyboard);
+        leftStick->getDirectionButton(JoyControlStick::StickLeft)->setAssignedSlot(Qt::Key_Q, JoyButtonSlot::JoyKeyboard);
+        leftStick->getDirectionButton(JoyControlStick::StickRight)
+            ->setAssignedSlot(Qt::Key_E, JoyButtonSlot::JoyKeyboard);
+    }
+
+    if (rightStick != nullptr)
+    {
+        rightStick->getDirectionButton(JoyControlStick::StickUp)
+            ->setAssignedSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement);
+        rightStick->getDirectionButton(JoyControlStick::StickDown)
+            ->setAssignedSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement);
+        rightStick->getDirectionButton(JoyControlStick::StickLeft)
+            ->setAssignedSlot(JoyButtonSlot::MouseLeft, JoyButtonSlot::JoyMouseMovement);
+        rightStick->getDirectionButton(JoyControlStick::StickRight)
+            ->setAssignedSlot(JoyButtonSlot::MouseRight, JoyButtonSlot::JoyMouseMovement);
+    }
+}
+
+/**
+ * @brief Builds a deterministic session: both sticks turn circles, triggers
+ *  ramp up and down and every few frames a button changes its state.
+ */
+static std::vector<SDL_Event> generateSession(SDL_JoystickID which, int eventCount)
+{
+    std::vector<SDL_Event> events;
+    events.reserve(eventCount);
+
+    const double pi = std::acos(-1.0);
+    int frame = 0;
+
+    while (static_cast<int>(events.size()) < eventCount)
+    {
+        double angle = (frame % 64) * 2.0 * pi / 64.0;
+        Sint16 axisValues[BenchUtil::BENCH_AXES] = {
+            static_cast<Sint16>(std::lround(32000 * std::cos(angle))),
+            static_cast<Sint16>(std::lround(32000 * std::sin(angle))),
+            static_cast<Sint16>(std::lround(24000 * std::sin(angle))),
+            static_cast<Sint16>(std::lround(24000 * std::cos(angle))),
+            static_cast<Sint16>((frame * 1024) % 32768),
+            static_cast<Sint16>(32767 - (frame * 1024) % 32768),
+        };
+
+        for (int axis = 0; axis < BenchUtil::BENCH_AXES && static_cast<int>(events.size()) < eventCount; axis++)
+        {
+            SDL_Event event = {};
+            event.type = SDL_CONTROLLERAXISMOTION;
+            event.caxis.which = which;
+            event.caxis.axis = static_cast<Uint8>(axis);
+            event.caxis.value = axisValues[axis];
+            events.push_back(event);
+        }
+
+        if ((frame % 4 == 0) && static_cast<int>(events.size()) < eventCount)
+        {
+            SDL_Event event = {};
+            event.type = ((frame / 4) % 2 == 0) ? SDL_CONTROLLERBUTTONDOWN : SDL_CONTROLLERBUTTONUP;
+            event.cbutton.which = which;
+            event.cbutton.button = static_cast<Uint8>((frame / 8) % BenchUtil::BENCH_BUTTONS);
+            event.cbutton.state = (event.type == SDL_CONTROLLERBUTTONDOWN) ? SDL_PRESSED : SDL_RELEASED;
+            events.push_back(event);
+        }
+
+        frame++;
+    }
+
+    return events;
+}
+
+/**
+ * @brief Replays events in batches of one poll cycle and lets timers of
+ *  the mapping engine run between cycles.
+ */
+static void replay(BenchInputDaemon &daemon, const std::vector<SDL_Event> &events, int begin, int end, int batchSize)
+{
+    SDLEventRing ring(batchSize);
+
+    for (int i = begin; i < end;)
+    {
+        Uint32 now = SDL_GetTicks();
+
+        for (int j = 0; (j < batchSize) && (i < end); j++, i++)
+        {
+            SDL_Event event = events[i];
+            event.common.timestamp = now;
+            ring.enqueue(event);
+        }
+
+        daemon.dispatch(&ring);
+        QCoreApplication::processEvents();
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    // Run without a display server unless a platform was chosen explicitly.
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    qInstallMessageHandler(Logger::loggerMessageHandler);
+
+    QApplication app(argc, argv);
+    QCoreApplication::setApplicationName("antimicrox_bench");
+
+    QTextStream outstream(stdout);
+    Logger *appLogger = Logger::createInstance(&outstream, Logger::LogLevel::LOG_WARNING);
+
+    BenchUtil::registerMetaTypes();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Replays a synthetic controller session through the mapping engine.");
+    parser.addHelpOption();
+    parser.addOptions({
+        {"profile", "Profile loaded with XMLConfigReader. A built-in mapping is used when omitted.", "file"},
+        {"events", "Number of replayed SDL events.", "count", "200000"},
+        {"replay", "Session recorded with antimicrox --record. Replaces the synthetic session.", "file"},
+        {"batch", "Number of SDL events dispatched per input cycle.", "count", "8"},
+    });
+    parser.process(app);
+
+    int eventCount = qMax(1, parser.value("events").toInt());
+    int batchSize = qMax(1, parser.value("batch").toInt());
+
+    EventHandlerFactory *factory = EventHandlerFactory::getInstance("null");
+    NullEventHandler *handler = static_cast<NullEventHandler *>(factory->handler());
+    handler->init();
+
+    // Profiles store Qt key codes, so a key mapper is needed for reading them.
+    AntKeyMapper::getInstance(handler->getIdentifier());
+
+    QTemporaryDir settingsDir;
+    AntiMicroSettings settings(settingsDir.filePath("antimicrox_settings.ini"), QSettings::IniFormat);
+    QMap<SDL_JoystickID, InputDevice *> joysticks;
+    BenchInputDaemon *daemon = new BenchInputDaemon(&joysticks, &settings);
+
+    if (BenchUtil::attachVirtualController() < 0)
+    {
+        PRINT_STDERR() << "Could not attach a virtual SDL controller (SDL 2.0.14 or newer is required): " << SDL_GetError()
+                       << "\n";
+        return EXIT_FAILURE;
+    }
+
+    daemon->refreshJoysticks();
+
+    if (joysticks.isEmpty())
+    {
+        PRINT_STDERR() << "The virtual controller was not picked up by InputDaemon.\n";
+        return EXIT_FAILURE;
+    }
+
+    InputDevice *device = joysticks.first();
+
+    if (parser.isSet("profile"))
+    {
+        XMLConfigReader reader;
+        reader.setJoystick(device);
+        reader.setFileName(parser.value("profile"));
+
+        if (reader.read())
+        {
+            PRINT_STDERR() << "Could not load profile: " << reader.getErrorString() << "\n";
+            return EXIT_FAILURE;
+        }
+    } else
+    {
+        assignDefaultMapping(device);
+    }
+
+    std::vector<SDL_Event> events;
+
+    if (parser.isSet("replay"))
+    {
+        SDLEventPlayer player;
+
+        if (!player.open(parser.value("replay")))
+        {
+            PRINT_STDERR() << player.getErrorString() << "\n";
+            return EXIT_FAILURE;
+        }
+
+        // Every recorded controller is replayed on the virtual one.
+        for (SDL_JoystickID recorded : player.getRecordedDevices())
+            player.setTargetDevice(recorded, device->getSDLJoystickID());
+
+        events = player.getMappedEvents();
+        eventCount = static_cast<int>(events.size());
+
+        if (eventCount == 0)
+        {
+            PRINT_STDERR() << "The recording does not contain any input events.\n";
+            return EXIT_FAILURE;
+        }
+    } else
+    {
+        events = generateSession(device->getSDLJoystickID(), eventCount);
+    }
+
+    // Warm up caches and lazily created objects before measuring.
+    LatencyTracer::setEnabled(true);
+    replay(*daemon, events, 0, qMin(eventCount, 1000), batchSize);
+    LatencyTracer::reset();
+
+    quint64 keyboardBefore = handler->getCallCount(NullEventHandler::KeyboardCall);
+    quint64 mouseButtonBefore = handler->getCallCount(NullEventHandler::MouseButtonCall);
+    quint64 mouseBefore = handler->getCallCount(NullEventHandler::MouseCall);
+    quint64 allocationsBefore = allocationCount.load();
+    auto start = std::chrono::steady_clock::now();
+
+    replay(*daemon, events, 0, eventCount, batchSize);
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    quint64 allocations = allocationCount.load() - allocationsBefore;
+
+    QTextStream out(stdout);
+    out << "Profile:              " << (parser.isSet("profile") ? parser.value("profile") : "built-in") << "\n";
+    out << "Session:              " << (parser.isSet("replay") ? parser.value("replay") : "synthetic") << "\n";
+    out << "Replayed events:      " << eventCount << " in batches of " << batchSize << "\n";
+    out << "Elapsed:              " << QString::number(elapsed * 1000.0, 'f', 2) << " ms\n";
+    out << "Throughput:           " << QString::number(eventCount / elapsed, 'f', 0) << " events/s\n";
+    out << "Allocations per event: " << QString::number(static_cast<double>(allocations) / eventCount, 'f', 2) << "\n";
+    out << "Generated output:     " << (handler->getCallCount(NullEventHandler::KeyboardCall) - keyboardBefore)
+        << " keyboard, " << (handler->getCallCount(NullEventHandler::MouseButtonCall) - mouseButtonBefore)
+        << " mouse button, " << (handler->getCallCount(NullEventHandler::MouseCall) - mouseBefore)
+        << " mouse movement\n";
+    out << LatencyTracer::getReport() << "\n";
+    out.flush();
+
+    delete daemon;
+    AntKeyMapper::getInstance()->deleteInstance();
+    factory->deleteInstance();
+    delete appLogger;
+
+    return EXIT_SUCCESS;
+}
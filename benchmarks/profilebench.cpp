@@ -0,0 +1,335 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file profilebench.cpp
+ * @brief Benchmark of profile loading and saving.
+ *
+ * Synthetic profiles of increasing size are generated on a virtual SDL game
+ * controller: every set gets every button filled with slots of all types of
+ * JoyButtonSlot::JoySlotInputAction. Each profile is saved with
+ * XMLConfigWriter and then loaded from XML, loaded from the compiled profile
+ * cache and saved again. Finally a save -> load -> save round trip has to
+ * reproduce the file byte for byte.
+ */
+
+#include "benchutil.h"
+
+#include "antimicrosettings.h"
+#include "antkeymapper.h"
+#include "common.h"
+#include "eventhandlerfactory.h"
+#include "globalvariables.h"
+#include "inputdaemon.h"
+#include "inputdevice.h"
+#include "joybuttonslot.h"
+#include "joybuttontypes/joybutton.h"
+#include "logger.h"
+#include "profilecache.h"
+#include "setjoystick.h"
+#include "xml/inputdevicexml.h"
+#include "xmlconfigreader.h"
+#include "xmlconfigwriter.h"
+
+#include <SDL2/SDL.h>
+
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTextStream>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+struct ProfileSize
+{
+    int sets;
+    int slots;
+};
+
+static const ProfileSize PROFILE_SIZES[] = {{1, 1}, {2, 2}, {4, 4}, {8, 8}, {8, 16}};
+
+/**
+ * @brief Creates a slot of the given type with data the profile reader accepts.
+ * @param[in] profilePath existing profile used as target of JoyLoadProfile slots
+ */
+static JoyButtonSlot *createSlot(JoyButtonSlot::JoySlotInputAction mode, int seed, const QString &profilePath,
+                                 QObject *parent)
+{
+    switch (mode)
+    {
+    case JoyButtonSlot::JoyKeyboard: {
+        int qtKey = Qt::Key_A + seed % 26;
+        int virtualKey = AntKeyMapper::getInstance()->returnVirtualKey(qtKey);
+        return new JoyButtonSlot(virtualKey > 0 ? virtualKey : qtKey, qtKey, mode, parent);
+    }
+    case JoyButtonSlot::JoyMouseButton:
+        return new JoyButtonSlot(1 + seed % 5, mode, parent);
+    case JoyButtonSlot::JoyMouseMovement:
+        return new JoyButtonSlot(JoyButtonSlot::MouseUp + seed % 4, mode, parent);
+    case JoyButtonSlot::JoyCycle:
+        return new JoyButtonSlot(0, mode, parent);
+    case JoyButtonSlot::JoyDistance:
+        return new JoyButtonSlot(5, mode, parent);
+    case JoyButtonSlot::JoyMouseSpeedMod:
+        return new JoyButtonSlot(50 + seed % 100, mode, parent);
+    case JoyButtonSlot::JoySetChange:
+        return new JoyButtonSlot(seed % GlobalVariables::InputDevice::NUMBER_JOYSETS, mode, parent);
+    case JoyButtonSlot::JoyLoadProfile:
+        return new JoyButtonSlot(profilePath, mode, parent);
+    case JoyButtonSlot::JoyTextEntry:
+        return new JoyButtonSlot(QString("synthetic text %1").arg(seed), mode, parent);
+    case JoyButtonSlot::JoyExecute: {
+        JoyButtonSlot *slot = new JoyButtonSlot(QCoreApplication::applicationFilePath(), mode, parent);
+        slot->setExtraData(QString("--help"));
+        return slot;
+    }
+    case JoyButtonSlot::JoyMix: {
+        JoyButtonSlot *slot = new JoyButtonSlot(0, mode, parent);
+        JoyButtonSlot *first = createSlot(JoyButtonSlot::JoyKeyboard, seed, profilePath, nullptr);
+        JoyButtonSlot *second = createSlot(JoyButtonSlot::JoyKeyboard, seed + 1, profilePath, nullptr);
+        slot->appendMiniSlot<JoyButtonSlot *>(first);
+        slot->appendMiniSlot<JoyButtonSlot *>(second);
+        slot->setTextData(QString("%1+%2").arg(first->getSlotString(), second->getSlotString()));
+        return slot;
+    }
+    default:
+        return new JoyButtonSlot(10 * (5 + seed % 10), mode, parent);
+    }
+}
+
+/**
+ * @brief Replaces the mapping of the device by a synthetic one.
+ */
+static void populateDevice(InputDevice *device, const ProfileSize &size, const QString &profilePath)
+{
+    const int slotTypes = JoyButtonSlot::JoyMix + 1;
+    device->transferReset();
+
+    for (int setIndex = 0; setIndex < size.sets; setIndex++)
+    {
+        SetJoystick *set = device->getSetJoystick(setIndex);
+
+        for (int buttonIndex = 0; buttonIndex < set->getNumberButtons(); buttonIndex++)
+        {
+            JoyButton *button = set->getJoyButton(buttonIndex);
+
+            if (button == nullptr)
+                continue;
+
+            for (int slotIndex = 0; slotIndex < size.slots; slotIndex++)
+            {
+                int seed = setIndex + buttonIndex + slotIndex;
+                auto mode = static_cast<JoyButtonSlot::JoySlotInputAction>(seed % slotTypes);
+                JoyButtonSlot *slot = createSlot(mode, seed, profilePath, button);
+
+                if (!button->insertAssignedSlot(slot, false))
+                    delete slot;
+            }
+
+            button->buildActiveZoneSummaryString();
+        }
+    }
+}
+
+/**
+ * @returns true on success.
+ */
+static bool saveProfile(InputDevice *device, const QString &profilePath, QString *error)
+{
+    XMLConfigWriter writer;
+    InputDeviceXml deviceXml(device);
+    writer.setFileName(profilePath);
+    writer.write(&deviceXml);
+    XMLConfigWriter::waitForPendingWrites();
+
+    if (writer.hasError())
+        *error = writer.getErrorString();
+
+    return !writer.hasError();
+}
+
+/**
+ * @returns true on success.
+ */
+static bool loadProfile(InputDevice *device, const QString &profilePath, QString *error)
+{
+    XMLConfigReader reader;
+    reader.setJoystick(device);
+    reader.setFileName(profilePath);
+    bool failed = reader.read();
+
+    if (failed)
+        *error = reader.getErrorString();
+
+    // Readers hand their helpers to deleteLater().
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+    return !failed;
+}
+
+static QByteArray readFile(const QString &path)
+{
+    QFile file(path);
+    return file.open(QIODevice::ReadOnly) ? file.readAll() : QByteArray();
+}
+
+/**
+ * @returns median duration of the given operation in milliseconds.
+ */
+static double measure(int iterations, const std::function<void()> &operation)
+{
+    std::vector<double> durations;
+    durations.reserve(iterations);
+
+    for (int i = 0; i < iterations; i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        operation();
+        durations.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    std::sort(durations.begin(), durations.end());
+    return durations[durations.size() / 2];
+}
+
+int main(int argc, char *argv[])
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    qInstallMessageHandler(Logger::loggerMessageHandler);
+
+    QApplication app(argc, argv);
+    QCoreApplication::setApplicationName("antimicrox_profile_bench");
+
+    QTextStream outstream(stdout);
+    Logger *appLogger = Logger::createInstance(&outstream, Logger::LogLevel::LOG_WARNING);
+
+    BenchUtil::registerMetaTypes();
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Measures loading and saving of synthetic profiles of increasing size.");
+    parser.addHelpOption();
+    parser.addOptions({
+        {"iterations", "Number of measured runs per operation, the median is reported.", "count", "5"},
+        {"corpus", "Keep the generated profiles in this directory, e.g. as seed corpus for fuzzing.", "directory"},
+    });
+    parser.process(app);
+
+    int iterations = qMax(1, parser.value("iterations").toInt());
+
+    EventHandlerFactory *factory = EventHandlerFactory::getInstance("null");
+    factory->handler()->init();
+    AntKeyMapper::getInstance(factory->handler()->getIdentifier());
+
+    QTemporaryDir workDir;
+    QString profileDir = parser.isSet("corpus") ? parser.value("corpus") : workDir.path();
+    QDir().mkpath(profileDir);
+
+    AntiMicroSettings settings(workDir.filePath("antimicrox_settings.ini"), QSettings::IniFormat);
+    QMap<SDL_JoystickID, InputDevice *> joysticks;
+    InputDaemon *daemon = new InputDaemon(&joysticks, &settings, false);
+
+    if (BenchUtil::attachVirtualController() < 0)
+    {
+        PRINT_STDERR() << "Could not attach a virtual SDL controller (SDL 2.0.14 or newer is required): " << SDL_GetError()
+                       << "\n";
+        return EXIT_FAILURE;
+    }
+
+    daemon->refreshJoysticks();
+
+    if (joysticks.isEmpty())
+    {
+        PRINT_STDERR() << "The virtual controller was not picked up by InputDaemon.\n";
+        return EXIT_FAILURE;
+    }
+
+    InputDevice *device = joysticks.first();
+    QTextStream out(stdout);
+    bool success = true;
+
+    out << "sets slots       bytes  load xml ms  load cache ms  save ms  round trip\n";
+
+    for (const ProfileSize &size : PROFILE_SIZES)
+    {
+        QString profilePath = QDir(profileDir).filePath(
+            QString("synthetic-%1x%2.%3.amgp").arg(size.sets).arg(size.slots).arg(device->getXmlName()));
+        QString savePath = workDir.filePath("save.amgp");
+        QString roundTripPath = workDir.filePath("roundtrip.amgp");
+        QString error;
+
+        // JoyLoadProfile slots point to the profile itself, it has to exist while reading.
+        QFile(profilePath).open(QIODevice::WriteOnly);
+        populateDevice(device, size, profilePath);
+
+        if (!saveProfile(device, profilePath, &error))
+        {
+            PRINT_STDERR() << "Could not save " << profilePath << ": " << error << "\n";
+            success = false;
+            break;
+        }
+
+        ProfileCache::setEnabled(false);
+        double loadXml = measure(iterations, [&] { loadProfile(device, profilePath, &error); });
+
+        ProfileCache::setEnabled(true);
+        ProfileCache::discard(profilePath);
+        loadProfile(device, profilePath, &error);
+        double loadCache = measure(iterations, [&] { loadProfile(device, profilePath, &error); });
+        ProfileCache::discard(profilePath);
+        ProfileCache::setEnabled(false);
+
+        // A missing file is always written, unchanged files would be skipped.
+        double save = measure(iterations, [&] {
+            QFile::remove(savePath);
+            saveProfile(device, savePath, &error);
+        });
+
+        QFile::remove(roundTripPath);
+        bool stable = loadProfile(device, profilePath, &error) && saveProfile(device, savePath, &error) &&
+                      loadProfile(device, savePath, &error) && saveProfile(device, roundTripPath, &error);
+        QByteArray generated = readFile(profilePath);
+        stable = stable && (readFile(savePath) == generated) && (readFile(roundTripPath) == generated);
+        success = success && stable;
+
+        out << QString("%1 %2 %3 %4 %5 %6  %7\n")
+                   .arg(size.sets, 4)
+                   .arg(size.slots, 5)
+                   .arg(generated.size(), 11)
+                   .arg(loadXml, 12, 'f', 2)
+                   .arg(loadCache, 14, 'f', 2)
+                   .arg(save, 8, 'f', 2)
+                   .arg(stable ? "stable" : "CHANGED");
+        out.flush();
+
+        if (!error.isEmpty())
+            PRINT_STDERR() << error << "\n";
+    }
+
+    delete daemon;
+    AntKeyMapper::getInstance()->deleteInstance();
+    factory->deleteInstance();
+    delete appLogger;
+
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
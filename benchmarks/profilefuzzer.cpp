@@ -0,0 +1,119 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file profilefuzzer.cpp
+ * @brief libFuzzer harness for InputDeviceXml::readConfig.
+ *
+ * Every input is read as a profile into a virtual SDL game controller.
+ * Profiles written by `antimicrox_profile_bench --corpus <dir>` make a good
+ * seed corpus:
+ *
+ *     antimicrox_profile_fuzz -max_len=1048576 <dir>
+ */
+
+#include "benchutil.h"
+
+#include "antimicrosettings.h"
+#include "antkeymapper.h"
+#include "eventhandlerfactory.h"
+#include "inputdaemon.h"
+#include "inputdevice.h"
+#include "logger.h"
+#include "xml/inputdevicexml.h"
+
+#include <SDL2/SDL.h>
+
+#include <QApplication>
+#include <QTemporaryDir>
+#include <QTextStream>
+#include <QXmlStreamReader>
+
+#include <cstdint>
+#include <cstdlib>
+
+static InputDevice *fuzzDevice = nullptr;
+
+extern "C" int LLVMFuzzerInitialize(int *argc, char ***argv)
+{
+    if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+
+    qInstallMessageHandler(Logger::loggerMessageHandler);
+
+    // Everything below lives until the process ends.
+    QApplication *app = new QApplication(*argc, *argv);
+    QCoreApplication::setApplicationName("antimicrox_profile_fuzz");
+
+    QTextStream *outstream = new QTextStream(stderr);
+    Logger::createInstance(outstream, Logger::LogLevel::LOG_NONE);
+
+    BenchUtil::registerMetaTypes();
+
+    EventHandlerFactory *factory = EventHandlerFactory::getInstance("null");
+    factory->handler()->init();
+    AntKeyMapper::getInstance(factory->handler()->getIdentifier());
+
+    QTemporaryDir *settingsDir = new QTemporaryDir();
+    AntiMicroSettings *settings =
+        new AntiMicroSettings(settingsDir->filePath("antimicrox_settings.ini"), QSettings::IniFormat, app);
+    QMap<SDL_JoystickID, InputDevice *> *joysticks = new QMap<SDL_JoystickID, InputDevice *>();
+    InputDaemon *daemon = new InputDaemon(joysticks, settings, false);
+
+    if (BenchUtil::attachVirtualController() < 0)
+    {
+        PRINT_STDERR() << "Could not attach a virtual SDL controller: " << SDL_GetError() << "\n";
+        std::abort();
+    }
+
+    daemon->refreshJoysticks();
+
+    if (joysticks->isEmpty())
+    {
+        PRINT_STDERR() << "The virtual controller was not picked up by InputDaemon.\n";
+        std::abort();
+    }
+
+    fuzzDevice = joysticks->first();
+    return 0;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    // Start every input from a fresh device like loading a profile in the
+    // GUI does, so a crash reproduces from the single input that caused it.
+    fuzzDevice->revertProfileEdited();
+
+    if (fuzzDevice->getActiveSetNumber() != 0)
+        fuzzDevice->setActiveSetNumber(0);
+
+    fuzzDevice->transferReset();
+    fuzzDevice->resetButtonDownCount();
+    fuzzDevice->reInitButtons();
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+    QByteArray input = QByteArray::fromRawData(reinterpret_cast<const char *>(data), static_cast<int>(size));
+    QXmlStreamReader reader(input);
+    reader.readNextStartElement();
+
+    InputDeviceXml deviceXml(fuzzDevice);
+    deviceXml.readConfig(&reader);
+
+    // Slots and helpers created while reading may be handed to deleteLater().
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+    return 0;
+}
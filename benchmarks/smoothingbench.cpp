@@ -0,0 +1,136 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file smoothingbench.cpp
+ * @brief Benchmark of the mouse smoothing history.
+ *
+ * Feeds the same pseudo random displacements to MouseHistory and to the list
+ * based implementation it replaced, reports the time per mouse tick of both
+ * and fails when their weighted averages differ.
+ */
+
+#include "mousehistory.h"
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QList>
+#include <QTextStream>
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Smoothing as done before MouseHistory: prepend the newest value,
+ *  drop the oldest one and walk the whole list on every tick.
+ */
+static double legacyTick(QList<double> &history, int historySize, double value, double weightModifier)
+{
+    if (history.size() >= historySize)
+        history.removeLast();
+
+    history.prepend(value);
+
+    double currentWeight = 1.0;
+    double finalWeight = 0.0;
+    double sum = 0.0;
+
+    QListIterator<double> iter(history);
+    while (iter.hasNext())
+    {
+        sum += iter.next() * currentWeight;
+        finalWeight += currentWeight;
+        currentWeight *= weightModifier;
+    }
+
+    return (std::fabs(sum) > 0) ? sum / finalWeight : 0.0;
+}
+
+static double ringTick(MouseHistory &history, double value, double weightModifier)
+{
+    history.push(value, weightModifier);
+    return history.weightedAverage();
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName("antimicrox_smoothing_bench");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Compares the mouse smoothing history with the former list based one.");
+    parser.addHelpOption();
+    parser.addOptions({
+        {"ticks", "Number of mouse ticks per history size.", "count", "1000000"},
+        {"weight", "Weight modifier used for smoothing.", "value", "0.9"},
+    });
+    parser.process(app);
+
+    int ticks = qMax(1, parser.value("ticks").toInt());
+    double weightModifier = parser.value("weight").toDouble();
+    QTextStream out(stdout);
+    bool mismatch = false;
+
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<double> distribution(-127.0, 127.0);
+    std::vector<double> input(static_cast<size_t>(ticks));
+
+    for (double &value : input)
+        value = distribution(generator);
+
+    out << "size   legacy ns/tick   ring ns/tick\n";
+
+    for (int historySize : {1, 10, 50, MouseHistory::CAPACITY})
+    {
+        QList<double> legacy;
+        MouseHistory ring;
+        ring.setSize(historySize);
+
+        std::vector<double> legacyOutput(input.size());
+        std::vector<double> ringOutput(input.size());
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < input.size(); i++)
+            legacyOutput[i] = legacyTick(legacy, historySize, input[i], weightModifier);
+        double legacyNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < input.size(); i++)
+            ringOutput[i] = ringTick(ring, input[i], weightModifier);
+        double ringNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            if (std::fabs(legacyOutput[i] - ringOutput[i]) > 1e-6)
+            {
+                out << "Mismatch at size " << historySize << ", tick " << i << ": " << legacyOutput[i]
+                    << " != " << ringOutput[i] << "\n";
+                mismatch = true;
+                break;
+            }
+        }
+
+        out << qSetFieldWidth(4) << historySize << qSetFieldWidth(17) << legacyNs / ticks << qSetFieldWidth(15)
+            << ringNs / ticks << qSetFieldWidth(0) << "\n";
+    }
+
+    out.flush();
+    return mismatch ? EXIT_FAILURE : EXIT_SUCCESS;
+}
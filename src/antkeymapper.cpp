@@ -39,6 +39,7 @@ static QStringList buildEventGeneratorList()
 #ifdef WITH_UINPUT
     temp.append("uinput");
 #endif
+    temp.append("null");
 
     return temp;
 }
@@ -58,7 +59,7 @@ AntKeyMapper::AntKeyMapper(QString handler, QObject *parent)
     #endif
 
     #ifdef WITH_UINPUT
-    if (handler == "uinput")
+    if ((handler == "uinput") || (handler == "null"))
     {
         internalMapper = &uinputMapper;
         #ifdef WITH_XTEST
@@ -67,9 +68,16 @@ AntKeyMapper::AntKeyMapper(QString handler, QObject *parent)
         nativeKeyMapper = nullptr;
         #endif
     }
+    #elif defined(WITH_XTEST)
+    // The null event generator only needs some mapping of Qt keys.
+    if (handler == "null")
+    {
+        internalMapper = &x11Mapper;
+        nativeKeyMapper = nullptr;
+    }
     #endif
 #elif defined Q_OS_WIN
-    BACKEND_ELSE_IF(handler == "sendinput")
+    BACKEND_ELSE_IF((handler == "sendinput") || (handler == "null"))
     {
         internalMapper = &winMapper;
         nativeKeyMapper = 0;
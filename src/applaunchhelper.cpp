@@ -22,6 +22,8 @@
 #include "globalvariables.h"
 #include "inputdevice.h"
 #include "joybuttontypes/joybutton.h"
+#include "mouseoutputthread.h"
+#include "profilecache.h"
 
 #include <QDebug>
 #include <QMapIterator>
@@ -40,11 +42,15 @@ AppLaunchHelper::AppLaunchHelper(AntiMicroSettings *settings, bool graphical, QO
 
 void AppLaunchHelper::initRunMethods()
 {
+    changeProfileCache();
+
     if (graphical)
     {
         establishMouseTimerConnections();
         enablePossibleMouseSmoothing();
         changeMouseRefreshRate();
+        changeMouseOutputRate();
+        changeMouseHighResolution();
         changeSpringModeScreen();
         changeGamepadPollRate();
 #ifdef Q_OS_WIN
@@ -93,6 +99,21 @@ void AppLaunchHelper::changeMouseRefreshRate()
     }
 }
 
+void AppLaunchHelper::changeMouseOutputRate()
+{
+    int outputRate =
+        settings->value("Mouse/OutputRate", GlobalVariables::AntimicroSettings::defaultMouseOutputRate).toInt();
+
+    if (outputRate > 0)
+        MouseOutputThread::setRate(outputRate);
+}
+
+void AppLaunchHelper::changeMouseHighResolution()
+{
+    GlobalVariables::JoyButton::highResolutionMouse =
+        settings->value("Mouse/HighResolution", GlobalVariables::AntimicroSettings::defaultHighResolutionMouse).toBool();
+}
+
 void AppLaunchHelper::changeGamepadPollRate()
 {
     int pollRate = settings->value("GamepadPollRate", GlobalVariables::AntimicroSettings::defaultSDLGamepadPollRate).toInt();
@@ -101,6 +122,17 @@ void AppLaunchHelper::changeGamepadPollRate()
         JoyButton::setGamepadRefreshRate(pollRate, GlobalVariables::JoyButton::gamepadRefreshRate,
                                          JoyButton::getMouseHelper());
     }
+
+    bool waitForEvents =
+        settings->value("GamepadWaitForEvents", GlobalVariables::AntimicroSettings::defaultSDLGamepadWaitForEvents).toBool();
+    JoyButton::setGamepadWaitForEvents(waitForEvents, GlobalVariables::JoyButton::gamepadWaitForEvents,
+                                       JoyButton::getMouseHelper());
+}
+
+void AppLaunchHelper::changeProfileCache()
+{
+    ProfileCache::setEnabled(
+        settings->value("CompiledProfileCache", GlobalVariables::AntimicroSettings::defaultCompiledProfileCache).toBool());
 }
 
 void AppLaunchHelper::printControllerList(QMap<SDL_JoystickID, InputDevice *> *joysticks)
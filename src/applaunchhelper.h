@@ -42,8 +42,11 @@ class AppLaunchHelper : public QObject
     void enablePossibleMouseSmoothing();
     void establishMouseTimerConnections();
     void changeMouseRefreshRate();
+    void changeMouseOutputRate();
+    void changeMouseHighResolution();
     void changeSpringModeScreen();
     void changeGamepadPollRate();
+    void changeProfileCache();
 #ifdef Q_OS_WIN
     void checkPointerPrecision();
 #endif
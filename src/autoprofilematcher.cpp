@@ -0,0 +1,192 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "autoprofilematcher.h"
+
+#include "autoprofileinfo.h"
+
+#include <QQueue>
+
+AutoProfileMatcher::AutoProfileMatcher() { clear(); }
+
+void AutoProfileMatcher::clear()
+{
+    m_rules.clear();
+    m_exe_index.clear();
+    m_class_index.clear();
+    m_title_index.clear();
+    m_nodes.clear();
+    m_nodes.append(Node{QHash<ushort, int>(), QVector<int>(), 0, 0});
+}
+
+/**
+ * @brief Adds an active rule. All of its non-empty properties have to match.
+ *  compile() has to be called after the last rule was added.
+ */
+void AutoProfileMatcher::addRule(AutoProfileInfo *info)
+{
+    int index = m_rules.size();
+    int requiredMatches = 0;
+
+    if (!info->getExe().isEmpty())
+    {
+        m_exe_index[info->getExe()].append(index);
+        requiredMatches++;
+    }
+
+    if (!info->getWindowClass().isEmpty())
+    {
+        m_class_index[info->getWindowClass()].append(index);
+        requiredMatches++;
+    }
+
+    if (!info->getWindowName().isEmpty())
+    {
+        if (info->isPartialState())
+            addPartialTitle(info->getWindowName(), index);
+        else
+            m_title_index[info->getWindowName()].append(index);
+
+        requiredMatches++;
+    }
+
+    m_rules.append(Rule{info, requiredMatches});
+}
+
+void AutoProfileMatcher::addPartialTitle(const QString &title, int rule)
+{
+    int state = 0;
+
+    for (const QChar &character : title)
+    {
+        int next = m_nodes.at(state).next.value(character.unicode(), 0);
+
+        if (next == 0)
+        {
+            next = m_nodes.size();
+            m_nodes[state].next.insert(character.unicode(), next);
+            m_nodes.append(Node{QHash<ushort, int>(), QVector<int>(), 0, 0});
+        }
+
+        state = next;
+    }
+
+    m_nodes[state].rules.append(rule);
+}
+
+/**
+ * @brief Builds the failure and output links of the partial title automaton.
+ */
+void AutoProfileMatcher::compile()
+{
+    QQueue<int> pending;
+
+    for (int child : m_nodes.at(0).next)
+    {
+        m_nodes[child].fail = 0;
+        m_nodes[child].output = 0;
+        pending.enqueue(child);
+    }
+
+    while (!pending.isEmpty())
+    {
+        int current = pending.dequeue();
+
+        for (auto iter = m_nodes.at(current).next.constBegin(); iter != m_nodes.at(current).next.constEnd(); ++iter)
+        {
+            int fail = m_nodes.at(current).fail;
+
+            while ((fail != 0) && !m_nodes.at(fail).next.contains(iter.key()))
+                fail = m_nodes.at(fail).fail;
+
+            fail = m_nodes.at(fail).next.value(iter.key(), 0);
+
+            Node &child = m_nodes[iter.value()];
+            child.fail = fail;
+            child.output = m_nodes.at(fail).rules.isEmpty() ? m_nodes.at(fail).output : fail;
+            pending.enqueue(iter.value());
+        }
+    }
+}
+
+static void countHits(QHash<int, int> &hits, const QVector<int> &rules)
+{
+    for (int rule : rules)
+        hits[rule]++;
+}
+
+/**
+ * @brief Returns every active rule whose properties are all matched by the
+ *  given window. Empty arguments never match.
+ */
+QVector<AutoProfileMatcher::Match> AutoProfileMatcher::match(const QString &appLocation, const QString &baseAppFileName,
+                                                             const QString &windowClass, const QString &windowName) const
+{
+    QHash<int, int> hits;
+
+    if (!appLocation.isEmpty())
+        countHits(hits, m_exe_index.value(appLocation));
+
+    if (!baseAppFileName.isEmpty() && (baseAppFileName != appLocation))
+        countHits(hits, m_exe_index.value(baseAppFileName));
+
+    if (!windowClass.isEmpty())
+        countHits(hits, m_class_index.value(windowClass));
+
+    if (!windowName.isEmpty())
+    {
+        countHits(hits, m_title_index.value(windowName));
+
+        if (m_nodes.size() > 1)
+        {
+            QVector<int> titleRules;
+            int state = 0;
+
+            for (const QChar &character : windowName)
+            {
+                while ((state != 0) && !m_nodes.at(state).next.contains(character.unicode()))
+                    state = m_nodes.at(state).fail;
+
+                state = m_nodes.at(state).next.value(character.unicode(), 0);
+
+                for (int node = m_nodes.at(state).rules.isEmpty() ? m_nodes.at(state).output : state; node != 0;
+                     node = m_nodes.at(node).output)
+                {
+                    for (int rule : m_nodes.at(node).rules)
+                    {
+                        if (!titleRules.contains(rule))
+                            titleRules.append(rule);
+                    }
+                }
+            }
+
+            countHits(hits, titleRules);
+        }
+    }
+
+    QVector<Match> matches;
+
+    for (auto iter = hits.constBegin(); iter != hits.constEnd(); ++iter)
+    {
+        const Rule &rule = m_rules.at(iter.key());
+
+        if ((iter.value() == rule.requiredMatches) && rule.info->isActive())
+            matches.append(Match{rule.info, iter.value()});
+    }
+
+    return matches;
+}
@@ -0,0 +1,76 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+class AutoProfileInfo;
+
+/**
+ * @brief Index of auto profile rules compiled once when assignments change.
+ *  Executable, window class and full window titles are looked up in hashes,
+ *  partial titles are found in a single pass over the window title with an
+ *  Aho-Corasick automaton. The cost of a lookup depends on the title length
+ *  and on the number of hits, not on the number of rules.
+ */
+class AutoProfileMatcher
+{
+  public:
+    struct Match
+    {
+        AutoProfileInfo *info;
+        int matchedProperties;
+    };
+
+    AutoProfileMatcher();
+
+    void clear();
+    void addRule(AutoProfileInfo *info);
+    void compile();
+
+    QVector<Match> match(const QString &appLocation, const QString &baseAppFileName, const QString &windowClass,
+                         const QString &windowName) const;
+
+    inline bool isEmpty() const { return m_rules.isEmpty(); }
+    inline int getRuleCount() const { return m_rules.size(); }
+
+  private:
+    struct Rule
+    {
+        AutoProfileInfo *info;
+        int requiredMatches;
+    };
+
+    struct Node
+    {
+        QHash<ushort, int> next;
+        QVector<int> rules; ///< rules whose partial title ends here
+        int fail;
+        int output; ///< nearest node on the fail chain which ends a partial title
+    };
+
+    void addPartialTitle(const QString &title, int rule);
+
+    QVector<Rule> m_rules;
+    QHash<QString, QVector<int>> m_exe_index;
+    QHash<QString, QVector<int>> m_class_index;
+    QHash<QString, QVector<int>> m_title_index;
+    QVector<Node> m_nodes;
+};
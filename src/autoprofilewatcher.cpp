@@ -20,6 +20,7 @@
 
 #include "antimicrosettings.h"
 #include "autoprofileinfo.h"
+#include "profilepreloader.h"
 
 #include <QApplication>
 #include <QDebug>
@@ -29,6 +30,7 @@
 
 #if defined(Q_OS_UNIX) && defined(WITH_X11)
     #include "x11extras.h"
+    #include "x11focuswatcher.h"
 
 #elif defined(Q_OS_WIN)
     #include "winextras.h"
@@ -40,6 +42,8 @@ QTimer AutoProfileWatcher::checkWindowTimer;
 
 AutoProfileWatcher::AutoProfileWatcher(AntiMicroSettings *settings, QObject *parent)
     : QObject(parent)
+    , focusChangeTimer(this)
+    , focusWatcher(nullptr)
 {
     this->settings = settings;
     allDefaultInfo = nullptr;
@@ -49,6 +53,26 @@ AutoProfileWatcher::AutoProfileWatcher(AntiMicroSettings *settings, QObject *par
     syncProfileAssignment();
 
     connect(&(checkWindowTimer), &QTimer::timeout, _instance, &AutoProfileWatcher::runAppCheck);
+
+    // Coalesce bursts of focus and title notifications into one check
+    focusChangeTimer.setSingleShot(true);
+    focusChangeTimer.setInterval(0);
+    connect(&focusChangeTimer, &QTimer::timeout, this, &AutoProfileWatcher::runAppCheck);
+
+#if defined(Q_OS_UNIX) && defined(WITH_X11)
+    if (QApplication::platformName() == QStringLiteral("xcb"))
+    {
+        focusWatcher = new X11FocusWatcher(this);
+        connect(focusWatcher, &X11FocusWatcher::activeWindowChanged, this, &AutoProfileWatcher::scheduleAppCheck);
+        connect(focusWatcher, &X11FocusWatcher::activeWindowTitleChanged, this,
+                &AutoProfileWatcher::scheduleTitleCheck);
+        // The focus event may arrive while antimicrox is still the active application
+        connect(qApp, &QGuiApplication::applicationStateChanged, this, [this](Qt::ApplicationState state) {
+            if ((state != Qt::ApplicationActive) && (focusWatcher != nullptr) && focusWatcher->isActive())
+                scheduleAppCheck();
+        });
+    }
+#endif
 }
 
 AutoProfileWatcher::~AutoProfileWatcher()
@@ -68,11 +92,51 @@ void AutoProfileWatcher::disconnectWindowTimer()
 {
     checkWindowTimer.stop();
     disconnect(&(checkWindowTimer), &QTimer::timeout, _instance, nullptr);
+
+    if (_instance != nullptr)
+        _instance->stopTimer();
 }
 
-void AutoProfileWatcher::startTimer() { checkWindowTimer.start(CHECKTIME); }
+/**
+ * @brief Starts watching the focused window. Falls back to polling when
+ *  focus changes can't be delivered as events.
+ */
+void AutoProfileWatcher::startTimer()
+{
+#if defined(Q_OS_UNIX) && defined(WITH_X11)
+    if ((focusWatcher != nullptr) && focusWatcher->start())
+    {
+        qDebug() << "Watching focus changes with X11 PropertyNotify events";
+        checkWindowTimer.stop();
+        runAppCheck();
+        return;
+    }
+#endif
 
-void AutoProfileWatcher::stopTimer() { checkWindowTimer.stop(); }
+    checkWindowTimer.start(CHECKTIME);
+}
+
+void AutoProfileWatcher::stopTimer()
+{
+    checkWindowTimer.stop();
+    focusChangeTimer.stop();
+
+#if defined(Q_OS_UNIX) && defined(WITH_X11)
+    if (focusWatcher != nullptr)
+        focusWatcher->stop();
+#endif
+}
+
+void AutoProfileWatcher::scheduleAppCheck() { focusChangeTimer.start(); }
+
+/**
+ * @brief Title changes only matter when some profile is assigned by window title.
+ */
+void AutoProfileWatcher::scheduleTitleCheck()
+{
+    if (!getWindowNameProfileAssignments().isEmpty())
+        focusChangeTimer.start();
+}
 
 void AutoProfileWatcher::runAppCheck()
 {
@@ -163,149 +227,18 @@ void AutoProfileWatcher::runAppCheck()
                            "Class = \"%2\", Program = \"%3\" or \"%4\".")
                        .arg(nowWindowName, nowWindowClass, appLocation, baseAppFileName);
 
-        QSet<AutoProfileInfo *> fullSet;
-
-        if (!appLocation.isEmpty() && getAppProfileAssignments().contains(appLocation))
-        {
-#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-            auto templist = getAppProfileAssignments().value(appLocation);
-            QSet<AutoProfileInfo *> tempSet(templist.begin(), templist.end());
-#else
-            QSet<AutoProfileInfo *> tempSet;
-            tempSet = getAppProfileAssignments().value(appLocation).toSet();
-#endif
-            fullSet.unite(tempSet);
-        } else if (!baseAppFileName.isEmpty() && getAppProfileAssignments().contains(baseAppFileName))
-        {
-#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-            auto templist = getAppProfileAssignments().value(baseAppFileName);
-            QSet<AutoProfileInfo *> tempSet(templist.begin(), templist.end());
-#else
-            QSet<AutoProfileInfo *> tempSet;
-            tempSet = getAppProfileAssignments().value(baseAppFileName).toSet();
-#endif
-            fullSet.unite(tempSet);
-        }
-
-        if (!nowWindowClass.isEmpty() && getWindowClassProfileAssignments().contains(nowWindowClass))
-        {
-
-#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-            auto templist = getWindowClassProfileAssignments().value(nowWindowClass);
-            QSet<AutoProfileInfo *> tempSet(templist.begin(), templist.end());
-#else
-            QSet<AutoProfileInfo *> tempSet;
-            tempSet = getWindowClassProfileAssignments().value(nowWindowClass).toSet();
-#endif
-            fullSet.unite(tempSet);
-        }
-
-        // part window title
-        if (!nowWindowName.isEmpty())
-        {
-            QHashIterator<QString, QList<AutoProfileInfo *>> iter(getWindowNameProfileAssignments());
-            while (iter.hasNext())
-            {
-                iter.next();
-
-                bool hasOnePartName = false;
-
-                for (auto autoInfo : iter.value())
-                {
-                    if (autoInfo->isPartialState())
-                    {
-                        hasOnePartName = true;
-                        break;
-                    }
-                }
-
-                if (hasOnePartName)
-                {
-                    qDebug() << "IT HAS A PARTIAL TITLE NAME";
-
-                    if (nowWindowName.contains(iter.key()))
-                    {
-                        qDebug() << "WINDOW: \"" << nowWindowName << "\" includes \"" << iter.key() << "\"";
-
-                        QSet<AutoProfileInfo *> tempSet;
-                        QList<AutoProfileInfo *> list = iter.value();
-#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-                        tempSet = QSet<AutoProfileInfo *>(list.begin(), list.end());
-#else
-                        tempSet = list.toSet();
-#endif
-                        fullSet = fullSet.unite(tempSet);
-
-                    } else
-                    {
-                        qDebug() << "WINDOW: \"" << nowWindowName << "\" doesn't include \"" << iter.key() << "\"";
-                    }
-
-                } else
-                {
-                    qDebug() << "IT HAS A FULL TITLE NAME";
-
-                    if (iter.key() == nowWindowName)
-                    {
-                        qDebug() << "WINDOW: \"" << nowWindowName << "\" is equal to hash key: \"" << iter.key() << "\"";
-
-#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
-                        auto templist = getWindowNameProfileAssignments().value(nowWindowName);
-                        QSet<AutoProfileInfo *> tempSet(templist.begin(), templist.end());
-#else
-                        QSet<AutoProfileInfo *> tempSet;
-                        tempSet = getWindowNameProfileAssignments().value(nowWindowName).toSet();
-#endif
-                        fullSet = fullSet.unite(tempSet);
-
-                    } else
-                    {
-                        qDebug() << "WINDOW: \"" << nowWindowName << "\" is not equal to hash key: \"" << iter.key() << "\"";
-                    }
-                }
-            }
-        }
-
         QHash<QString, int> highestMatchCount;
         QHash<QString, AutoProfileInfo *> highestMatches;
 
-        for (auto &&info : fullSet)
+        for (const AutoProfileMatcher::Match &match :
+             profileMatcher.match(appLocation, baseAppFileName, nowWindowClass, nowWindowName))
         {
-            if (info->isActive())
-            {
-                int numProps = 0;
-                numProps += !info->getExe().isEmpty() ? 1 : 0;
-                numProps += !info->getWindowClass().isEmpty() ? 1 : 0;
-                numProps += !info->getWindowName().isEmpty() ? 1 : 0;
-
-                int numMatched = 0;
-                numMatched +=
-                    (!info->getExe().isEmpty() && (info->getExe() == appLocation || info->getExe() == baseAppFileName)) ? 1
-                                                                                                                        : 0;
-                numMatched += (!info->getWindowClass().isEmpty() && info->getWindowClass() == nowWindowClass) ? 1 : 0;
-
-                if (info->isPartialState())
-                {
-                    numMatched +=
-                        (!info->getWindowName().isEmpty() && nowWindowName.contains(info->getWindowName())) ? 1 : 0;
-                } else
-                {
-                    numMatched += (!info->getWindowName().isEmpty() && info->getWindowName() == nowWindowName) ? 1 : 0;
-                }
+            QString uniqueID = match.info->getUniqueID();
 
-                if (numProps == numMatched && highestMatchCount.contains(info->getUniqueID()))
-                {
-                    int currentHigh = highestMatchCount.value(info->getUniqueID());
-                    if (numMatched > currentHigh)
-                    {
-                        highestMatchCount.insert(info->getUniqueID(), numMatched);
-                        highestMatches.insert(info->getUniqueID(), info);
-                    }
-                } else if (numProps == numMatched && !highestMatchCount.contains(info->getUniqueID()))
-                {
-                    highestMatchCount.insert(info->getUniqueID(), numMatched);
-                    highestMatches.insert(info->getUniqueID(), info);
-                }
+            if (!highestMatchCount.contains(uniqueID) || (match.matchedProperties > highestMatchCount.value(uniqueID)))
+            {
+                highestMatchCount.insert(uniqueID, match.matchedProperties);
+                highestMatches.insert(uniqueID, match.info);
             }
         }
 
@@ -496,6 +429,8 @@ void AutoProfileWatcher::syncProfileAssignment()
                         appProfileAssignments.insert(baseExe, templist);
                     }
                 }
+
+                profileMatcher.addRule(info);
             }
         } else
         {
@@ -505,10 +440,43 @@ void AutoProfileWatcher::syncProfileAssignment()
 
     settings->endGroup();
     settings->getLock()->unlock();
+
+    profileMatcher.compile();
+    preloadProfiles();
+}
+
+/**
+ * @brief Prepares every profile an auto profile rule can switch to, so that
+ *  switching does not have to wait for the file.
+ */
+void AutoProfileWatcher::preloadProfiles()
+{
+    QStringList profilePaths;
+
+    if (allDefaultInfo != nullptr)
+        profilePaths.append(allDefaultInfo->getProfileLocation());
+
+    for (auto *info : getDefaultProfileAssignments())
+        profilePaths.append(info->getProfileLocation());
+
+    for (const auto &assignments :
+         {getAppProfileAssignments(), getWindowClassProfileAssignments(), getWindowNameProfileAssignments()})
+    {
+        for (const auto &profileList : assignments)
+        {
+            for (auto *info : profileList)
+                profilePaths.append(info->getProfileLocation());
+        }
+    }
+
+    profilePaths.removeDuplicates();
+    ProfilePreloader::getInstance()->preload(profilePaths);
 }
 
 void AutoProfileWatcher::clearProfileAssignments()
 {
+    profileMatcher.clear();
+
     QSet<AutoProfileInfo *> terminateProfiles;
 
     for (const auto &profileList : appProfileAssignments.values())
@@ -19,6 +19,8 @@
 #ifndef AUTOPROFILEWATCHER_H
 #define AUTOPROFILEWATCHER_H
 
+#include "autoprofilematcher.h"
+
 #include <QHash>
 #include <QSet>
 #include <QTimer>
@@ -26,11 +28,14 @@
 class AntiMicroSettings;
 class AutoProfileInfo;
 class QSettings;
+class X11FocusWatcher;
 
 /**
  * @brief Manages auto profile functionality. Allows for profiles to be associated with specific applications.
  *
  * Watches currently focused window and changes current set to pre-defined one when app is recognized.
+ * On X11 with an EWMH compliant window manager focus and title changes are delivered as events,
+ * otherwise the focused window is polled every CHECKTIME ms.
  */
 class AutoProfileWatcher : public QObject
 {
@@ -59,6 +64,7 @@ class AutoProfileWatcher : public QObject
     QString findAppLocation();
     void clearProfileAssignments();
     void convToUniqueIDAutoProfGroupSett(QSettings *sett, QString guidAutoProfSett, QString uniqueAutoProfSett);
+    void preloadProfiles();
 
   signals:
     void foundApplicableProfile(AutoProfileInfo *info);
@@ -68,6 +74,8 @@ class AutoProfileWatcher : public QObject
 
   private slots:
     void runAppCheck();
+    void scheduleAppCheck();
+    void scheduleTitleCheck();
 
   private:
     // QSet<QString>& getGuidSetLocal();
@@ -75,11 +83,14 @@ class AutoProfileWatcher : public QObject
 
     static AutoProfileWatcher *_instance;
     static QTimer checkWindowTimer;
+    QTimer focusChangeTimer;
+    X11FocusWatcher *focusWatcher;
     AntiMicroSettings *settings;
     QHash<QString, QList<AutoProfileInfo *>> appProfileAssignments;
     QHash<QString, QList<AutoProfileInfo *>> windowClassProfileAssignments;
     QHash<QString, QList<AutoProfileInfo *>> windowNameProfileAssignments;
     QHash<QString, AutoProfileInfo *> defaultProfileAssignments;
+    AutoProfileMatcher profileMatcher;
     AutoProfileInfo *allDefaultInfo;
     QString currentApplication;
     QString currentAppWindowTitle;
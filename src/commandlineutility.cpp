@@ -41,6 +41,7 @@ CommandLineUtility::CommandLineUtility(QObject *parent)
     unloadProfile = false;
     startSetNumber = 0;
     listControllers = false;
+    latencyTrace = false;
     currentLogLevel = Logger::LOG_NONE;
 
     currentListsIndex = 0;
@@ -93,7 +94,8 @@ void CommandLineUtility::parseArguments(const QApplication &parsed_app)
          QCoreApplication::translate("main", "Choose between using XTest support and uinput support "
                                              "for event generation. Use only if you have "
                                              "enabled xtest and uinput options on Linux or vmulti on "
-                                             "Windows. Default: xtest."),
+                                             "Windows. Use null to only count generated events without "
+                                             "sending them. Default: xtest."),
          QCoreApplication::translate("main", "event-generation-type"), "xtest"}, // default
         {{"list", "l"},
          QCoreApplication::translate("main", "Print information about joysticks detected by SDL. Use "
@@ -102,6 +104,15 @@ void CommandLineUtility::parseArguments(const QApplication &parsed_app)
                                              "even GUID.")},
         {"next", QCoreApplication::translate("main", "Load multiple profiles for different controllers. This option is "
                                                      "meant to be used with profile-controller and profile options.")},
+        {"latency-trace",
+         QCoreApplication::translate("main", "Measure latency of every input event from SDL to the event generator and "
+                                             "log per-stage statistics (p50, p99, max) when quitting.")},
+        {"record", QCoreApplication::translate("main", "Record raw controller input to a file for later replay"),
+         QCoreApplication::translate("main", "filename")},
+        {"replay",
+         QCoreApplication::translate("main", "Replay controller input recorded with --record instead of live "
+                                             "controller input"),
+         QCoreApplication::translate("main", "filename")},
 
     });
 
@@ -167,7 +178,27 @@ void CommandLineUtility::parseArguments(const QApplication &parsed_app)
             listControllers = true;
         }
 
-#if (defined(WITH_UINPUT) && defined(WITH_XTEST))
+        if (parser.isSet("latency-trace"))
+        {
+            latencyTrace = true;
+        }
+
+        if (parser.isSet("record"))
+        {
+            if (!parser.value("record").isEmpty())
+                recordFile = parser.value("record");
+            else
+                throw std::runtime_error(QObject::tr("No recording file specified.").toStdString());
+        }
+
+        if (parser.isSet("replay"))
+        {
+            if (!parser.value("replay").isEmpty() && QFileInfo::exists(parser.value("replay")))
+                replayFile = parser.value("replay");
+            else
+                throw std::runtime_error(
+                    QObject::tr("Specified replay file does not exist: %1").arg(parser.value("replay")).toStdString());
+        }
 
         if (parser.isSet("eventgen"))
         {
@@ -185,7 +216,6 @@ void CommandLineUtility::parseArguments(const QApplication &parsed_app)
                 throw std::runtime_error(QObject::tr("No event generator string was specified.").toStdString());
             }
         }
-#endif
 
         if (parser.isSet("log-level"))
         {
@@ -397,12 +427,18 @@ int CommandLineUtility::getJoyStartSetNumber() { return startSetNumber - 1; }
 
 bool CommandLineUtility::shouldListControllers() { return listControllers; }
 
+bool CommandLineUtility::isLatencyTraceEnabled() { return latencyTrace; }
+
 QString CommandLineUtility::getEventGenerator() { return eventGenerator; }
 
 Logger::LogLevel CommandLineUtility::getCurrentLogLevel() { return currentLogLevel; }
 
 QString CommandLineUtility::getCurrentLogFile() { return currentLogFile; }
 
+QString CommandLineUtility::getRecordFile() { return recordFile; }
+
+QString CommandLineUtility::getReplayFile() { return replayFile; }
+
 QList<ControllerOptionsInfo> const &CommandLineUtility::getControllerOptionsList() { return controllerOptionsList; }
 
 bool CommandLineUtility::hasProfileInOptions()
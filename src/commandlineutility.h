@@ -102,6 +102,7 @@ class CommandLineUtility : public QObject
     bool isShowRequested();
     bool isUnloadRequested();
     bool shouldListControllers();
+    bool isLatencyTraceEnabled();
     bool hasProfileInOptions();
 
     int getControllerNumber();
@@ -112,6 +113,8 @@ class CommandLineUtility : public QObject
     QString getProfileLocation();
     QString getEventGenerator();
     QString getCurrentLogFile();
+    QString getRecordFile();
+    QString getReplayFile();
 
     QList<int> *getJoyStartSetNumberList();
     QList<ControllerOptionsInfo> const &getControllerOptionsList();
@@ -126,6 +129,7 @@ class CommandLineUtility : public QObject
     bool showRequest;
     bool unloadProfile;
     bool listControllers;
+    bool latencyTrace;
 
     int startSetNumber;
     int controllerNumber;
@@ -135,6 +139,8 @@ class CommandLineUtility : public QObject
     QString controllerIDString;
     QString eventGenerator;
     QString currentLogFile;
+    QString recordFile;
+    QString replayFile;
 
     Logger::LogLevel currentLogLevel;
 
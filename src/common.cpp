@@ -220,7 +220,7 @@ void log_system_config()
 
 QWaitCondition waitThisOut;
 QMutex sdlWaitMutex;
-QMutex inputDaemonMutex;
+QReadWriteLock inputDaemonLock;
 bool editingBindings = false;
 MouseHelper mouseHelperObj;
 } // namespace PadderCommon
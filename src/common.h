@@ -26,6 +26,7 @@
 
 #include <QDir>
 #include <QIcon>
+#include <QReadWriteLock>
 #include <QThread>
 #include <QTranslator>
 #include <QWaitCondition>
@@ -151,7 +152,27 @@ const QString sdlVersionCompiled = ([] {
 
 extern QWaitCondition waitThisOut;
 extern QMutex sdlWaitMutex;
-extern QMutex inputDaemonMutex;
+/*
+ * Locks guarding the input objects, always taken in this order:
+ *
+ *  1. inputDaemonLock - taken for writing by the GUI while it changes input
+ *     objects. The input thread and the per-device input threads take it for
+ *     reading only while input objects process events. It is not recursive,
+ *     so it is never held while signals are emitted to the GUI, devices are
+ *     added or removed or other code which may take it for writing runs.
+ *  2. InputDevice registry mutex - taken by InputDevice::lockAllDevices()
+ *     and while a device is deleted.
+ *  3. InputDevice::getInputMutex() - held while the objects of a device
+ *     process events or fire timers. Only lockAllDevices() holds more than
+ *     one of them, in registration order.
+ *  4. JoyButton::lockSharedState() - recursive, guards the state shared by
+ *     all buttons like pending mouse buttons and cursor speeds.
+ *
+ * The queue of the mouse output thread is only fed with the shared button
+ * state held. Its motion mutex is taken last and nothing else is locked
+ * while it is held.
+ */
+extern QReadWriteLock inputDaemonLock;
 extern bool editingBindings;
 extern MouseHelper mouseHelperObj;
 
@@ -136,7 +136,7 @@ void DPadContextMenu::setDPadPreset(QAction *action)
     {
     case 0:
 
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
@@ -144,13 +144,13 @@ void DPadContextMenu::setDPadPreset(QAction *action)
         rightButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseRight, JoyButtonSlot::JoyMouseMovement, this);
         dpad->setJoyMode(JoyDPad::StandardMode);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         break;
 
     case 1:
 
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
@@ -158,13 +158,13 @@ void DPadContextMenu::setDPadPreset(QAction *action)
         rightButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseLeft, JoyButtonSlot::JoyMouseMovement, this);
         dpad->setJoyMode(JoyDPad::StandardMode);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         break;
 
     case 2:
 
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
@@ -172,13 +172,13 @@ void DPadContextMenu::setDPadPreset(QAction *action)
         rightButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseRight, JoyButtonSlot::JoyMouseMovement, this);
         dpad->setJoyMode(JoyDPad::StandardMode);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         break;
 
     case 3:
 
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
@@ -186,13 +186,13 @@ void DPadContextMenu::setDPadPreset(QAction *action)
         rightButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseLeft, JoyButtonSlot::JoyMouseMovement, this);
         dpad->setJoyMode(JoyDPad::StandardMode);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         break;
 
     case 4:
 
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(AntKeyMapper::getInstance()->returnVirtualKey(Qt::Key_Up), Qt::Key_Up,
                                          JoyButtonSlot::JoyKeyboard, this);
@@ -204,13 +204,13 @@ void DPadContextMenu::setDPadPreset(QAction *action)
                                             JoyButtonSlot::JoyKeyboard, this);
         dpad->setJoyMode(JoyDPad::StandardMode);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         break;
 
     case 5:
 
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(AntKeyMapper::getInstance()->returnVirtualKey(Qt::Key_W), Qt::Key_W,
                                          JoyButtonSlot::JoyKeyboard, this);
@@ -222,13 +222,13 @@ void DPadContextMenu::setDPadPreset(QAction *action)
                                             JoyButtonSlot::JoyKeyboard, this);
         dpad->setJoyMode(JoyDPad::StandardMode);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         break;
 
     case 6:
 
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         if ((dpad->getJoyMode() == JoyDPad::StandardMode) || (dpad->getJoyMode() == JoyDPad::FourWayCardinal))
         {
@@ -277,7 +277,7 @@ void DPadContextMenu::setDPadPreset(QAction *action)
                                   QtKeyMapperBase::AntKey_KP_3, JoyButtonSlot::JoyKeyboard, this);
         }
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         break;
 
@@ -312,7 +312,7 @@ int DPadContextMenu::getPresetIndex()
 {
     int result = 0;
 
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     JoyDPadButton *upButton = dpad->getJoyButton(JoyDPadButton::DpadUp);
     QList<JoyButtonSlot *> *upslots = upButton->getAssignedSlots();
@@ -412,7 +412,7 @@ int DPadContextMenu::getPresetIndex()
         result = 8;
     }
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 
     return result;
 }
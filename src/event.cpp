@@ -33,6 +33,7 @@
 #include "globalvariables.h"
 #include "joybuttontypes/joybutton.h"
 #include "logger.h"
+#include "mouseoutputthread.h"
 
 #if defined(Q_OS_UNIX)
     #if defined(WITH_X11)
@@ -148,6 +149,8 @@ void sendevent(JoyButtonSlot *slot, bool pressed)
         EventHandlerFactory::getInstance()->handler()->sendKeyboardEvent(slot, pressed);
     } else if (device == JoyButtonSlot::JoyMouseButton)
     {
+        // Clicks have to land where the cursor was moved to before.
+        MouseOutputThread::flush();
         EventHandlerFactory::getInstance()->handler()->sendMouseButtonEvent(slot, pressed);
     } else if ((device == JoyButtonSlot::JoyTextEntry) && pressed && !slot->getTextData().isEmpty())
     {
@@ -191,7 +194,11 @@ void sendevent(JoyButtonSlot *slot, bool pressed)
 }
 
 // Create the relative mouse event used by the operating system.
-void sendevent(int code1, int code2) { EventHandlerFactory::getInstance()->handler()->sendMouseEvent(code1, code2); }
+void sendevent(int code1, int code2)
+{
+    MouseOutputThread::flush();
+    EventHandlerFactory::getInstance()->handler()->sendMouseEvent(code1, code2);
+}
 
 // TODO: Re-implement spring event generation to simplify the process
 // and reduce overhead. Refactor old function to only be used when an absmouse
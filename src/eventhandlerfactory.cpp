@@ -36,6 +36,7 @@ static QHash<QString, QString> buildDisplayNames()
     temp.insert("xtest", "Xtest");
     temp.insert("uinput", "uinput");
 #endif
+    temp.insert("null", "Null");
     return temp;
 }
 
@@ -66,6 +67,9 @@ EventHandlerFactory::EventHandlerFactory(QString handler, QObject *parent)
         eventHandler = new WinSendInputEventHandler(this);
     }
 #endif
+
+    if (handler == "null")
+        eventHandler = new NullEventHandler(this);
 }
 
 EventHandlerFactory *EventHandlerFactory::getInstance(QString handler)
@@ -144,6 +148,7 @@ QStringList EventHandlerFactory::buildEventGeneratorList()
     temp.append("xtest");
     temp.append("uinput");
 #endif
+    temp.append("null");
     return temp;
 }
 
@@ -22,6 +22,8 @@
 #include <QObject>
 #include <QStringList>
 
+#include "eventhandlers/nulleventhandler.h"
+
 #ifdef WITH_UINPUT
     #include "eventhandlers/uinputeventhandler.h"
 #endif
@@ -66,3 +66,21 @@ void BaseEventHandler::sendMouseSpringEvent(int xDis, int yDis, int width, int h
 }
 
 void BaseEventHandler::sendTextEntryEvent(QString maintext) { Q_UNUSED(maintext); }
+
+/**
+ * @brief Do nothing by default. Child classes which can combine several
+ *     events into one write may hold back events until endBatch().
+ *     Batches can be nested, only the outermost endBatch() writes them.
+ */
+void BaseEventHandler::beginBatch() {}
+
+/**
+ * @brief Do nothing by default. Write events held back by the current batch
+ *     without ending it.
+ */
+void BaseEventHandler::flushBatch() {}
+
+/**
+ * @brief Do nothing by default. End a batch started with beginBatch().
+ */
+void BaseEventHandler::endBatch() {}
@@ -55,6 +55,10 @@ class BaseEventHandler : public QObject
 
     virtual void sendTextEntryEvent(QString maintext);
 
+    virtual void beginBatch();
+    virtual void flushBatch();
+    virtual void endBatch();
+
     virtual QString getName() = 0;
     virtual QString getIdentifier() = 0;
     virtual void printPostMessages();
@@ -0,0 +1,152 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "nulleventhandler.h"
+
+#include "joybuttonslot.h"
+#include "latencytracer.h"
+#include "logger.h"
+
+#include <QMutexLocker>
+
+const int NullEventHandler::TRACE_CAPACITY = 4096;
+
+NullEventHandler::NullEventHandler(QObject *parent)
+    : BaseEventHandler(parent)
+    , m_trace(TRACE_CAPACITY)
+    , m_trace_next(0)
+    , m_trace_wrapped(false)
+{
+    for (auto &count : m_call_counts)
+        count.store(0);
+}
+
+NullEventHandler::~NullEventHandler() {}
+
+bool NullEventHandler::init()
+{
+    m_clock.start();
+    return true;
+}
+
+bool NullEventHandler::cleanup()
+{
+    qInfo().noquote() << getSummary();
+    return true;
+}
+
+void NullEventHandler::sendKeyboardEvent(JoyButtonSlot *slot, bool pressed)
+{
+    recordCall(KeyboardCall, slot->getSlotCode(), pressed ? 1 : 0);
+}
+
+void NullEventHandler::sendMouseButtonEvent(JoyButtonSlot *slot, bool pressed)
+{
+    recordCall(MouseButtonCall, slot->getSlotCode(), pressed ? 1 : 0);
+}
+
+void NullEventHandler::sendMouseEvent(int xDis, int yDis) { recordCall(MouseCall, xDis, yDis); }
+
+void NullEventHandler::sendMouseAbsEvent(int xDis, int yDis, int screen)
+{
+    Q_UNUSED(screen);
+
+    recordCall(MouseAbsCall, xDis, yDis);
+}
+
+void NullEventHandler::sendMouseSpringEvent(int xDis, int yDis, int width, int height)
+{
+    Q_UNUSED(width);
+    Q_UNUSED(height);
+
+    recordCall(MouseSpringCall, xDis, yDis);
+}
+
+void NullEventHandler::sendTextEntryEvent(QString maintext) { recordCall(TextEntryCall, maintext.length(), 0); }
+
+QString NullEventHandler::getName() { return QString("null"); }
+
+QString NullEventHandler::getIdentifier() { return getName(); }
+
+void NullEventHandler::printPostMessages()
+{
+    PRINT_STDOUT() << QObject::tr("Null event generator selected. No keyboard or mouse events will be generated.")
+                   << "\n";
+}
+
+quint64 NullEventHandler::getCallCount(CallType type) const { return m_call_counts[type].load(); }
+
+quint64 NullEventHandler::getTotalCallCount() const
+{
+    quint64 total = 0;
+
+    for (const auto &count : m_call_counts)
+        total += count.load();
+
+    return total;
+}
+
+/**
+ * @brief Most recent calls in chronological order.
+ */
+QVector<NullEventHandler::TraceEntry> NullEventHandler::getTrace() const
+{
+    QMutexLocker locker(&m_trace_mutex);
+
+    if (!m_trace_wrapped)
+        return m_trace.mid(0, m_trace_next);
+
+    return m_trace.mid(m_trace_next) + m_trace.mid(0, m_trace_next);
+}
+
+/**
+ * @brief Number of calls per type and overall call rate since init().
+ */
+QString NullEventHandler::getSummary() const
+{
+    double seconds = m_clock.isValid() ? (m_clock.nsecsElapsed() / 1000000000.0) : 0.0;
+    quint64 total = getTotalCallCount();
+
+    return QString("Null event generator: %1 calls in %2 s (%3 calls/s). Keyboard: %4, mouse button: %5, "
+                   "mouse: %6, absolute mouse: %7, spring mouse: %8, text entry: %9")
+        .arg(total)
+        .arg(seconds, 0, 'f', 1)
+        .arg((seconds > 0.0) ? (total / seconds) : 0.0, 0, 'f', 0)
+        .arg(getCallCount(KeyboardCall))
+        .arg(getCallCount(MouseButtonCall))
+        .arg(getCallCount(MouseCall))
+        .arg(getCallCount(MouseAbsCall))
+        .arg(getCallCount(MouseSpringCall))
+        .arg(getCallCount(TextEntryCall));
+}
+
+void NullEventHandler::recordCall(CallType type, int code, int value)
+{
+    m_call_counts[type].fetch_add(1, std::memory_order_relaxed);
+    LatencyTracer::mark(LatencyTracer::OUTPUT);
+
+    QMutexLocker locker(&m_trace_mutex);
+
+    m_trace[m_trace_next] = {m_clock.isValid() ? m_clock.nsecsElapsed() : 0, type, code, value};
+    m_trace_next++;
+
+    if (m_trace_next == TRACE_CAPACITY)
+    {
+        m_trace_next = 0;
+        m_trace_wrapped = true;
+    }
+}
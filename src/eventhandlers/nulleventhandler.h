@@ -0,0 +1,99 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NULLEVENTHANDLER_H
+#define NULLEVENTHANDLER_H
+
+#include "baseeventhandler.h"
+
+#include <QElapsedTimer>
+#include <QMutex>
+#include <QVector>
+
+#include <atomic>
+
+class JoyButtonSlot;
+
+/**
+ * @brief Event handler which does not generate any events.
+ *  Calls are only counted and the most recent ones are kept in an
+ *  in-memory trace. Useful for measuring the mapping pipeline under load
+ *  on machines without /dev/uinput or an X server.
+ */
+class NullEventHandler : public BaseEventHandler
+{
+    Q_OBJECT
+
+  public:
+    enum CallType
+    {
+        KeyboardCall = 0,
+        MouseButtonCall,
+        MouseCall,
+        MouseAbsCall,
+        MouseSpringCall,
+        TextEntryCall,
+        CALL_TYPE_COUNT
+    };
+
+    struct TraceEntry
+    {
+        qint64 timestamp; ///< ns since init()
+        CallType type;
+        int code;         ///< slot code, x displacement or text length
+        int value;        ///< pressed state or y displacement
+    };
+
+    explicit NullEventHandler(QObject *parent = nullptr);
+    virtual ~NullEventHandler();
+
+    bool init() override;
+    bool cleanup() override;
+
+    void sendKeyboardEvent(JoyButtonSlot *slot, bool pressed) override;
+    void sendMouseButtonEvent(JoyButtonSlot *slot, bool pressed) override;
+    void sendMouseEvent(int xDis, int yDis) override;
+    void sendMouseAbsEvent(int xDis, int yDis, int screen) override;
+
+    void sendMouseSpringEvent(int xDis, int yDis, int width, int height) override;
+
+    void sendTextEntryEvent(QString maintext) override;
+
+    QString getName() override;
+    QString getIdentifier() override;
+    void printPostMessages() override;
+
+    quint64 getCallCount(CallType type) const;
+    quint64 getTotalCallCount() const;
+    QVector<TraceEntry> getTrace() const;
+    QString getSummary() const;
+
+    static const int TRACE_CAPACITY;
+
+  private:
+    void recordCall(CallType type, int code, int value);
+
+    std::atomic<quint64> m_call_counts[CALL_TYPE_COUNT];
+    QElapsedTimer m_clock;
+
+    mutable QMutex m_trace_mutex;
+    QVector<TraceEntry> m_trace;
+    int m_trace_next;
+    bool m_trace_wrapped;
+};
+
+#endif // NULLEVENTHANDLER_H
@@ -16,27 +16,80 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cerrno>
 #include <cmath>
+#include <cstring>
 #include <fcntl.h>
 #include <linux/input.h>
 #include <linux/uinput.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <QDebug>
 #include <QFileInfo>
+#include <QHash>
 #include <QMessageBox>
 #include <QStringList>
+#include <QThreadStorage>
 #include <QTimer>
+#include <QVector>
 
 #include <antkeymapper.h>
 #include <common.h>
 #include <joybuttonslot.h>
+#include <latencytracer.h>
 #include <logger.h>
 
 static const QString mouseDeviceName = PadderCommon::mouseDeviceName;
 static const QString keyboardDeviceName = PadderCommon::keyboardDeviceName;
 static const QString springMouseDeviceName = PadderCommon::springMouseDeviceName;
 
+namespace {
+/**
+ * @brief Events of one thread waiting for their EV_SYN. Every thread writing
+ *  output (input thread, device threads, mouse output thread) has its own,
+ *  so one thread never flushes the half finished frame of another one.
+ */
+struct PendingFrames
+{
+    int batchDepth = 0;
+    QHash<int, QVector<struct input_event>> events;
+};
+} // namespace
+
+static QThreadStorage<PendingFrames> pendingFrames;
+
+/**
+ * @brief Writes queued events of one file and a closing EV_SYN with one
+ *  syscall. uinput handles a write as a whole, so frames written by
+ *  different threads do not interleave.
+ */
+static void flushPendingEvents(int filehandle, QVector<struct input_event> &events)
+{
+    if (events.isEmpty())
+        return;
+
+    struct input_event syn;
+    memset(&syn, 0, sizeof(struct input_event));
+    gettimeofday(&syn.time, nullptr);
+    syn.type = EV_SYN;
+    syn.code = SYN_REPORT;
+    syn.value = 0;
+
+    struct iovec iov[2];
+    iov[0].iov_base = events.data();
+    iov[0].iov_len = static_cast<size_t>(events.size()) * sizeof(struct input_event);
+    iov[1].iov_base = &syn;
+    iov[1].iov_len = sizeof(struct input_event);
+
+    if (writev(filehandle, iov, 2) < 0)
+        DEBUG() << "Could not write uinput events: " << strerror(errno);
+
+    events.clear();
+
+    LatencyTracer::mark(LatencyTracer::OUTPUT);
+}
+
 #ifdef WITH_X11
     #if (QT_VERSION >= QT_VERSION_CHECK(5, 0, 0))
         #include <QApplication>
@@ -157,6 +210,8 @@ bool UInputEventHandler::cleanup() { return cleanupUinputEvHand(); }
 
 bool UInputEventHandler::cleanupUinputEvHand()
 {
+    flushAllPendingEvents();
+
     if (keyboardFileHandler > 0)
     {
         closeUInputDevice(keyboardFileHandler);
@@ -220,26 +275,26 @@ void UInputEventHandler::sendMouseButtonEvent(JoyButtonSlot *slot, bool pressed)
         {
             if (pressed)
             {
-                write_uinput_event(mouseFileHandler, EV_REL, REL_WHEEL, 1);
+                writeWheelEvent(REL_WHEEL, 1);
             }
 
         } else if (code == 5)
         {
             if (pressed)
             {
-                write_uinput_event(mouseFileHandler, EV_REL, REL_WHEEL, -1);
+                writeWheelEvent(REL_WHEEL, -1);
             }
         } else if (code == 6)
         {
             if (pressed)
             {
-                write_uinput_event(mouseFileHandler, EV_REL, REL_HWHEEL, -1);
+                writeWheelEvent(REL_HWHEEL, -1);
             }
         } else if (code == 7)
         {
             if (pressed)
             {
-                write_uinput_event(mouseFileHandler, EV_REL, REL_HWHEEL, 1);
+                writeWheelEvent(REL_HWHEEL, 1);
             }
         } else if (code == 8)
         {
@@ -257,6 +312,21 @@ void UInputEventHandler::sendMouseEvent(int xDis, int yDis)
     write_uinput_event(mouseFileHandler, EV_REL, REL_Y, yDis);
 }
 
+/**
+ * @brief Sends wheel notches. Devices announcing the high resolution wheel
+ *     axes have to report them together with the legacy ones, 120 units
+ *     being one notch.
+ */
+void UInputEventHandler::writeWheelEvent(int code, int notches)
+{
+#ifdef REL_WHEEL_HI_RES
+    int hiResCode = (code == REL_WHEEL) ? REL_WHEEL_HI_RES : REL_HWHEEL_HI_RES;
+    write_uinput_event(mouseFileHandler, EV_REL, hiResCode, notches * 120, false);
+#endif
+
+    write_uinput_event(mouseFileHandler, EV_REL, code, notches);
+}
+
 void UInputEventHandler::sendMouseAbsEvent(int xDis, int yDis, int screen)
 {
     Q_UNUSED(screen);
@@ -342,6 +412,10 @@ void UInputEventHandler::setRelMouseEvents(int filehandle)
     ioctl(filehandle, UI_SET_RELBIT, REL_Y);
     ioctl(filehandle, UI_SET_RELBIT, REL_WHEEL);
     ioctl(filehandle, UI_SET_RELBIT, REL_HWHEEL);
+#ifdef REL_WHEEL_HI_RES
+    ioctl(filehandle, UI_SET_RELBIT, REL_WHEEL_HI_RES);
+    ioctl(filehandle, UI_SET_RELBIT, REL_HWHEEL_HI_RES);
+#endif
 
     ioctl(filehandle, UI_SET_KEYBIT, BTN_LEFT);
     ioctl(filehandle, UI_SET_KEYBIT, BTN_RIGHT);
@@ -439,27 +513,69 @@ void UInputEventHandler::closeUInputDevice(int filehandle)
 
 void UInputEventHandler::write_uinput_event(int filehandle, int type, int code, int value, bool syn)
 {
-    struct input_event ev;
-    struct input_event ev2;
+    PendingFrames &frames = pendingFrames.localData();
+    QVector<struct input_event> &events = frames.events[filehandle];
 
+    struct input_event ev;
     memset(&ev, 0, sizeof(struct input_event));
     gettimeofday(&ev.time, nullptr);
+
+    if (type == EV_KEY)
+    {
+        // A key changing its state twice within one frame would be seen as
+        // a single state by consumers. Close the frame before the second change.
+        for (int i = events.size() - 1; (i >= 0) && (events.at(i).type != EV_SYN); i--)
+        {
+            if ((events.at(i).type == EV_KEY) && (events.at(i).code == code))
+            {
+                ev.type = EV_SYN;
+                ev.code = SYN_REPORT;
+                events.append(ev);
+                break;
+            }
+        }
+    }
+
     ev.type = type;
     ev.code = code;
     ev.value = value;
+    events.append(ev);
 
-    write(filehandle, &ev, sizeof(struct input_event));
+    if (syn && (frames.batchDepth == 0))
+        flushPendingEvents(filehandle, events);
+}
 
-    if (syn)
-    {
-        memset(&ev2, 0, sizeof(struct input_event));
-        gettimeofday(&ev2.time, nullptr);
-        ev2.type = EV_SYN;
-        ev2.code = SYN_REPORT;
-        ev2.value = 0;
+/**
+ * @brief Writes the queued events of the calling thread.
+ */
+void UInputEventHandler::flushAllPendingEvents()
+{
+    PendingFrames &frames = pendingFrames.localData();
 
-        write(filehandle, &ev2, sizeof(struct input_event));
-    }
+    for (auto iter = frames.events.begin(); iter != frames.events.end(); ++iter)
+        flushPendingEvents(iter.key(), iter.value());
+}
+
+/**
+ * @brief Holds back events of the calling thread until the matching
+ *     endBatch() so that all events of one input cycle are written as a
+ *     single frame per device.
+ */
+void UInputEventHandler::beginBatch() { pendingFrames.localData().batchDepth++; }
+
+void UInputEventHandler::flushBatch() { flushAllPendingEvents(); }
+
+void UInputEventHandler::endBatch()
+{
+    PendingFrames &frames = pendingFrames.localData();
+
+    if (frames.batchDepth == 0)
+        return;
+
+    frames.batchDepth--;
+
+    if (frames.batchDepth == 0)
+        flushAllPendingEvents();
 }
 
 QString UInputEventHandler::getName() { return QString("uinput"); }
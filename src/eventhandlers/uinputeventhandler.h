@@ -21,6 +21,8 @@
 
 #include "baseeventhandler.h"
 
+#include <linux/input.h>
+
 /**
  * @brief Input event handler class using uinput files
  *
@@ -54,6 +56,10 @@ class UInputEventHandler : public BaseEventHandler
 
     virtual void sendTextEntryEvent(QString maintext) override;
 
+    virtual void beginBatch() override;
+    virtual void flushBatch() override;
+    virtual void endBatch() override;
+
     int getKeyboardFileHandler();
     int getMouseFileHandler();
     int getSpringMouseFileHandler();
@@ -72,6 +78,12 @@ class UInputEventHandler : public BaseEventHandler
     /**
      * @brief Write uinput event to selected file uinput file
      *
+     * Events are queued per file and written together with a single EV_SYN
+     * once syn is set. Inside of a batch (see beginBatch) they are held back
+     * until the batch ends, so all events of one input cycle reach the
+     * consumer as one frame. Queues and batches belong to the calling thread,
+     * events of other threads are written as frames of their own.
+     *
      * @param filehandle - C-style linux file handle obtained by open()
      * @param type type of event described in input-event-codes.h (for example EV_ABS )
      * @param code Additional code like ABS_X for type EV_ABS
@@ -79,6 +91,8 @@ class UInputEventHandler : public BaseEventHandler
      * @param syn synchronize after event (emit additional event used for separation of events EV_SYN)
      */
     void write_uinput_event(int filehandle, int type, int code, int value, bool syn = true);
+    void writeWheelEvent(int code, int notches);
+    void flushAllPendingEvents();
 
   private slots:
 #ifdef WITH_X11
@@ -21,6 +21,7 @@
 #include "antkeymapper.h"
 #include "globalvariables.h"
 #include "joybuttonslot.h"
+#include "latencytracer.h"
 
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
@@ -65,6 +66,7 @@ void XTestEventHandler::sendKeyboardEvent(JoyButtonSlot *slot, bool pressed)
         {
             XTestFakeKeyEvent(display, tempcode, pressed, 0);
             XFlush(display);
+            LatencyTracer::mark(LatencyTracer::OUTPUT);
         }
     }
 }
@@ -80,6 +82,7 @@ void XTestEventHandler::sendMouseButtonEvent(JoyButtonSlot *slot, bool pressed)
     {
         XTestFakeButtonEvent(display, code, pressed, 0);
         XFlush(display);
+        LatencyTracer::mark(LatencyTracer::OUTPUT);
     }
 }
 
@@ -88,6 +91,7 @@ void XTestEventHandler::sendMouseEvent(int xDis, int yDis)
     Display *display = X11Extras::getInstance()->display();
     XTestFakeRelativeMotionEvent(display, xDis, yDis, 0);
     XFlush(display);
+    LatencyTracer::mark(LatencyTracer::OUTPUT);
 }
 
 void XTestEventHandler::sendMouseAbsEvent(int xDis, int yDis, int screen)
@@ -25,6 +25,7 @@
 #include "globalvariables.h"
 #include "joybuttontypes/joycontrolstickbutton.h"
 #include "joycontrolstick.h"
+#include "joysensor.h"
 
 #include <cmath>
 
@@ -321,6 +322,88 @@ bool GameController::isGameController() { return true; }
 
 bool GameController::isRelevantUniqueID(QString tempUniqueID) { return InputDevice::isRelevantUniqueID(tempUniqueID); }
 
+/**
+ * @brief Maps game controller events onto the active set. Plain joystick
+ *  events of the device only update the raw values used by the mapping
+ *  dialog.
+ * @return true if an element has a pending event which has to be activated
+ */
+bool GameController::dispatchEvent(const SDL_Event &event)
+{
+    SetJoystick *set = getActiveSetJoystick();
+    bool queued = false;
+
+    switch (event.type)
+    {
+    case SDL_JOYBUTTONDOWN:
+    case SDL_JOYBUTTONUP:
+        rawButtonEvent(event.jbutton.button, event.type == SDL_JOYBUTTONDOWN);
+        break;
+
+    case SDL_JOYAXISMOTION:
+        rawAxisEvent(event.jaxis.axis, event.jaxis.value);
+        break;
+
+    case SDL_JOYHATMOTION:
+        rawDPadEvent(event.jhat.hat, event.jhat.value);
+        break;
+
+    case SDL_CONTROLLERAXISMOTION: {
+        JoyAxis *axis = set->getJoyAxis(event.caxis.axis);
+
+        if (axis != nullptr)
+        {
+            axis->queuePendingEvent(event.caxis.value);
+            queued = true;
+        }
+
+        break;
+    }
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+    case SDL_CONTROLLERSENSORUPDATE: {
+        JoySensor *sensor = nullptr;
+        if (event.csensor.sensor == SDL_SENSOR_ACCEL)
+            sensor = set->getSensor(ACCELEROMETER);
+        else if (event.csensor.sensor == SDL_SENSOR_GYRO)
+            sensor = set->getSensor(GYROSCOPE);
+        else
+            Q_ASSERT(false);
+
+        if (sensor != nullptr)
+        {
+    #if SDL_VERSION_ATLEAST(2, 26, 0)
+            sensor->queuePendingEvent(event.csensor.data, false, event.csensor.timestamp_us);
+    #else
+            sensor->queuePendingEvent(event.csensor.data);
+    #endif
+            queued = true;
+        }
+
+        break;
+    }
+#endif
+
+    case SDL_CONTROLLERBUTTONDOWN:
+    case SDL_CONTROLLERBUTTONUP: {
+        JoyButton *button = set->getJoyButton(event.cbutton.button);
+
+        if (button != nullptr)
+        {
+            button->queuePendingEvent(event.type == SDL_CONTROLLERBUTTONDOWN);
+            queued = true;
+        }
+
+        break;
+    }
+
+    default:
+        break;
+    }
+
+    return queued;
+}
+
 void GameController::rawButtonEvent(int index, bool pressed)
 {
     bool knownbutton = getRawbuttons().contains(index);
@@ -88,6 +88,7 @@ class GameController : public InputDevice
     void rawButtonEvent(int index, bool pressed);
     void rawAxisEvent(int index, int value);
     void rawDPadEvent(int index, int value);
+    virtual bool dispatchEvent(const SDL_Event &event) override;
 
     QHash<int, bool> const &getRawbuttons();
     QHash<int, int> const &getAxisvalues();
@@ -54,9 +54,10 @@ const int GlobalVariables::JoyButton::MAXCYCLERESETTIME = 60000;
 
 const int GlobalVariables::JoyButton::DEFAULTMOUSEHISTORYSIZE = 10;
 const double GlobalVariables::JoyButton::DEFAULTWEIGHTMODIFIER = 0.2;
-const int GlobalVariables::JoyButton::MAXIMUMMOUSEHISTORYSIZE = 100;
+const int GlobalVariables::JoyButton::MAXIMUMMOUSEHISTORYSIZE = MouseHistory::CAPACITY;
 const double GlobalVariables::JoyButton::MAXIMUMWEIGHTMODIFIER = 1.0;
 const int GlobalVariables::JoyButton::MAXIMUMMOUSEREFRESHRATE = 16;
+const int GlobalVariables::JoyButton::CURSORSUBPIXELS = 256;
 int GlobalVariables::JoyButton::IDLEMOUSEREFRESHRATE = (5 * 20);
 const int GlobalVariables::JoyButton::DEFAULTIDLEMOUSEREFRESHRATE = 100;
 const double GlobalVariables::JoyButton::DEFAULTEXTRACCELVALUE = 2.0;
@@ -71,12 +72,15 @@ QHash<int, int> GlobalVariables::JoyButton::activeKeys;
 QHash<int, int> GlobalVariables::JoyButton::activeMouseButtons;
 
 // History buffers used for mouse smoothing routine.
-QList<double> GlobalVariables::JoyButton::mouseHistoryX;
-QList<double> GlobalVariables::JoyButton::mouseHistoryY;
+MouseHistory GlobalVariables::JoyButton::mouseHistoryX;
+MouseHistory GlobalVariables::JoyButton::mouseHistoryY;
 
 // Carry over remainder of a cursor move for the next mouse event.
 double GlobalVariables::JoyButton::cursorRemainderX = 0.0;
 double GlobalVariables::JoyButton::cursorRemainderY = 0.0;
+qint64 GlobalVariables::JoyButton::cursorSubpixelRemainderX = 0;
+qint64 GlobalVariables::JoyButton::cursorSubpixelRemainderY = 0;
+bool GlobalVariables::JoyButton::highResolutionMouse = false;
 
 double GlobalVariables::JoyButton::weightModifier = 0;
 // Mouse history buffer size
@@ -85,6 +89,7 @@ int GlobalVariables::JoyButton::mouseHistorySize = 1;
 int GlobalVariables::JoyButton::mouseRefreshRate = 5;
 int GlobalVariables::JoyButton::springModeScreen = -1;
 int GlobalVariables::JoyButton::gamepadRefreshRate = 10;
+bool GlobalVariables::JoyButton::gamepadWaitForEvents = false;
 
 // ---- ANTIMICROSETTINGS --- //
 
@@ -92,6 +97,17 @@ const bool GlobalVariables::AntimicroSettings::defaultDisabledWinEnhanced = fals
 const bool GlobalVariables::AntimicroSettings::defaultAssociateProfiles = true;
 const int GlobalVariables::AntimicroSettings::defaultSpringScreen = -1;
 const int GlobalVariables::AntimicroSettings::defaultSDLGamepadPollRate = 10; // unsigned
+const bool GlobalVariables::AntimicroSettings::defaultSDLGamepadWaitForEvents = false;
+const bool GlobalVariables::AntimicroSettings::defaultGamepadThreadPerDevice = false;
+const bool GlobalVariables::AntimicroSettings::defaultCompiledProfileCache = true;
+const int GlobalVariables::AntimicroSettings::defaultMouseOutputRate = 0; // Hz, 0 sends on every mouse refresh
+const bool GlobalVariables::AntimicroSettings::defaultHighResolutionMouse = false;
+
+// ---- SDLEVENTREADER ---- //
+
+// Interval in ms at which SDL is still pumped while waiting for events.
+// Catches joysticks SDL registers after their device node showed up.
+const int GlobalVariables::SDLEventReader::WAITEVENTTIMEOUT = 1000;
 
 // ---- INPUTDEVICE ---- //
 
@@ -200,6 +216,8 @@ const double GlobalVariables::JoySensor::GYRO_MAX = 360.0;
 const double GlobalVariables::JoySensor::DEFAULTDEADZONE = 20;
 const int GlobalVariables::JoySensor::DEFAULTDIAGONALRANGE = 45;
 const unsigned int GlobalVariables::JoySensor::DEFAULTSENSORDELAY = 0;
+const double GlobalVariables::JoySensor::DEFAULTGYROMOUSESENSITIVITY = 10.0;
+const double GlobalVariables::JoySensor::DEFAULTGYROMOUSESMOOTHING = 0.0;
 
 // ---- JoyButtonSlot ---- //
 
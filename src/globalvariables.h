@@ -19,6 +19,8 @@
 #ifndef GLOBALVARIABLES_H
 #define GLOBALVARIABLES_H
 
+#include "mousehistory.h"
+
 #include <QList>
 #include <QObject>
 #include <QRegularExpression>
@@ -36,9 +38,16 @@ class JoyButton
     static int springModeScreen;
     // gamepad poll rate used by the application in ms
     static int gamepadRefreshRate;
+    // block until SDL reports an event instead of polling at gamepadRefreshRate
+    static bool gamepadWaitForEvents;
 
     static double cursorRemainderX;
     static double cursorRemainderY;
+    // remainder of high resolution cursor output in 1/CURSORSUBPIXELS pixels
+    static qint64 cursorSubpixelRemainderX;
+    static qint64 cursorSubpixelRemainderY;
+    // send cursor movement uncapped with a fixed-point remainder
+    static bool highResolutionMouse;
     static double mouseSpeedModifier;
     // Weight modifier in the range of 0.0 - 1.0
     static double weightModifier;
@@ -78,6 +87,7 @@ class JoyButton
     static const int DEFAULTMOUSEHISTORYSIZE;
     static const int MAXIMUMMOUSEHISTORYSIZE;
     static const int MAXIMUMMOUSEREFRESHRATE;
+    static const int CURSORSUBPIXELS;
     static const int DEFAULTIDLEMOUSEREFRESHRATE;
     static const int MINCYCLERESETTIME;
     static const int MAXCYCLERESETTIME;
@@ -85,8 +95,8 @@ class JoyButton
 
     static QHash<int, int> activeKeys;
     static QHash<int, int> activeMouseButtons;
-    static QList<double> mouseHistoryX;
-    static QList<double> mouseHistoryY;
+    static MouseHistory mouseHistoryX;
+    static MouseHistory mouseHistoryY;
 };
 
 class AntimicroSettings
@@ -96,6 +106,17 @@ class AntimicroSettings
     static const bool defaultAssociateProfiles;
     static const int defaultSpringScreen;
     static const int defaultSDLGamepadPollRate;
+    static const bool defaultSDLGamepadWaitForEvents;
+    static const bool defaultGamepadThreadPerDevice;
+    static const bool defaultCompiledProfileCache;
+    static const int defaultMouseOutputRate;
+    static const bool defaultHighResolutionMouse;
+};
+
+class SDLEventReader
+{
+  public:
+    static const int WAITEVENTTIMEOUT;
 };
 
 class InputDevice
@@ -233,6 +254,8 @@ class JoySensor
     static const double DEFAULTDEADZONE;
     static const int DEFAULTDIAGONALRANGE;
     static const unsigned int DEFAULTSENSORDELAY;
+    static const double DEFAULTGYROMOUSESENSITIVITY;
+    static const double DEFAULTGYROMOUSESMOOTHING;
 };
 
 class JoyButtonSlot
@@ -54,7 +54,7 @@ AdvanceButtonDialog::AdvanceButtonDialog(JoyButton *button, QWidget *parent)
     ui->stackedWidget->setCurrentWidget(ui->page);
     setAttribute(Qt::WA_DeleteOnClose);
 
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     // ui->splitSlotButton->hide();
 
@@ -218,7 +218,7 @@ AdvanceButtonDialog::AdvanceButtonDialog(JoyButton *button, QWidget *parent)
 
     changeSlotHelpText(ui->slotTypeComboBox->currentIndex());
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 
     ui->resetCycleDoubleSpinBox->setMaximum(GlobalVariables::JoyButton::MAXCYCLERESETTIME * 0.001); // static_cast<double>
 
@@ -890,7 +890,7 @@ void AdvanceButtonDialog::checkTurboSetting(bool state)
 
 void AdvanceButtonDialog::updateSetSelection()
 {
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     int chosen_set;
     JoyButton::SetChangeCondition set_selection_condition = JoyButton::SetChangeDisabled;
@@ -945,7 +945,7 @@ void AdvanceButtonDialog::updateSetSelection()
         m_button->setChangeSetCondition(JoyButton::SetChangeDisabled);
     }
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 }
 
 void AdvanceButtonDialog::checkTurboIntervalValue(int value)
@@ -24,6 +24,7 @@
 #include "buttoneditdialog.h"
 #include "common.h"
 #include "event.h"
+#include "guitelemetry.h"
 #include "haptictriggerps5.h"
 #include "inputdevice.h"
 #include "joyaxis.h"
@@ -148,9 +149,14 @@ AxisEditDialog::AxisEditDialog(JoyAxis *axis, bool keypadUnlocked, QWidget *pare
     connect(ui->throttleComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this,
             &AxisEditDialog::presetForThrottleChange);
 
-    connect(axis, &JoyAxis::moved, this, [this, axis](int value) { ui->axisstatusBox->setValue(axis, value); });
+    GuiTelemetry::getInstance()->watch(this);
+    connect(GuiTelemetry::getInstance(), &GuiTelemetry::axisMoved, this, [this, axis](JoyAxis *movedAxis, int value) {
+        if (movedAxis != axis)
+            return;
 
-    connect(axis, &JoyAxis::moved, this, &AxisEditDialog::updateJoyValue);
+        ui->axisstatusBox->setValue(axis, value);
+        updateJoyValue(value);
+    });
 
     connect(ui->deadZoneSpinBox, static_cast<void (QSpinBox::*)(int)>(&QSpinBox::valueChanged), this,
             &AxisEditDialog::updateDeadZoneSlider);
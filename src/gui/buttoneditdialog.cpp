@@ -161,7 +161,7 @@ void ButtonEditDialog::keyPressEvent(QKeyEvent *event)
 void ButtonEditDialog::setupVirtualKeyboardMouseTabWidget()
 {
 
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     ui->virtualKeyMouseTabWidget->hide();
     ui->virtualKeyMouseTabWidget->deleteLater();
@@ -169,7 +169,7 @@ void ButtonEditDialog::setupVirtualKeyboardMouseTabWidget()
         new VirtualKeyboardMouseWidget(joystick, &helper, m_isNumKeypad, currentQuickDialog, lastJoyButton, this);
     ui->verticalLayout->insertWidget(1, ui->virtualKeyMouseTabWidget);
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 
     connect(ui->virtualKeyMouseTabWidget, &VirtualKeyboardMouseWidget::selectionCleared, this,
             &ButtonEditDialog::refreshSlotSummaryLabel);
@@ -42,7 +42,7 @@ DPadEditDialog::DPadEditDialog(JoyDPad *dpad, QWidget *parent)
     this->dpad = dpad;
     getHelperLocal().moveToThread(dpad->thread());
 
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     updateWindowTitleDPadName();
 
@@ -73,7 +73,7 @@ DPadEditDialog::DPadEditDialog(JoyDPad *dpad, QWidget *parent)
     ui->dpadDelaySlider->setValue(dpadDelay * .1);
     ui->dpadDelayDoubleSpinBox->setValue(dpadDelay * .001);
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 
     connect(ui->presetsComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this,
             &DPadEditDialog::implementPresets);
@@ -107,28 +107,28 @@ void DPadEditDialog::implementPresets(int index)
     switch (index)
     {
     case 1:
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
         leftButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseLeft, JoyButtonSlot::JoyMouseMovement, this);
         rightButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseRight, JoyButtonSlot::JoyMouseMovement, this);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         ui->joyModeComboBox->setCurrentIndex(0);
         break;
 
     case 2:
 
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
         leftButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseRight, JoyButtonSlot::JoyMouseMovement, this);
         rightButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseLeft, JoyButtonSlot::JoyMouseMovement, this);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         ui->joyModeComboBox->setCurrentIndex(0);
 
@@ -136,14 +136,14 @@ void DPadEditDialog::implementPresets(int index)
 
     case 3:
 
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
         leftButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseLeft, JoyButtonSlot::JoyMouseMovement, this);
         rightButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseRight, JoyButtonSlot::JoyMouseMovement, this);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         ui->joyModeComboBox->setCurrentIndex(0);
 
@@ -151,14 +151,14 @@ void DPadEditDialog::implementPresets(int index)
 
     case 4:
 
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
         leftButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseRight, JoyButtonSlot::JoyMouseMovement, this);
         rightButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseLeft, JoyButtonSlot::JoyMouseMovement, this);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         ui->joyModeComboBox->setCurrentIndex(0);
 
@@ -166,7 +166,7 @@ void DPadEditDialog::implementPresets(int index)
 
     case 5:
 
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(AntKeyMapper::getInstance()->returnVirtualKey(Qt::Key_Up), Qt::Key_Up,
                                          JoyButtonSlot::JoyKeyboard, this);
@@ -177,7 +177,7 @@ void DPadEditDialog::implementPresets(int index)
         rightButtonSlot = new JoyButtonSlot(AntKeyMapper::getInstance()->returnVirtualKey(Qt::Key_Right), Qt::Key_Right,
                                             JoyButtonSlot::JoyKeyboard, this);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         ui->joyModeComboBox->setCurrentIndex(0);
 
@@ -185,7 +185,7 @@ void DPadEditDialog::implementPresets(int index)
 
     case 6:
 
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(AntKeyMapper::getInstance()->returnVirtualKey(Qt::Key_W), Qt::Key_W,
                                          JoyButtonSlot::JoyKeyboard, this);
@@ -196,7 +196,7 @@ void DPadEditDialog::implementPresets(int index)
         rightButtonSlot = new JoyButtonSlot(AntKeyMapper::getInstance()->returnVirtualKey(Qt::Key_D), Qt::Key_D,
                                             JoyButtonSlot::JoyKeyboard, this);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         ui->joyModeComboBox->setCurrentIndex(0);
 
@@ -204,7 +204,7 @@ void DPadEditDialog::implementPresets(int index)
 
     case 7:
 
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         if ((ui->joyModeComboBox->currentIndex() == 0) || (ui->joyModeComboBox->currentIndex() == 2))
         {
@@ -253,7 +253,7 @@ void DPadEditDialog::implementPresets(int index)
                                   QtKeyMapperBase::AntKey_KP_3, JoyButtonSlot::JoyKeyboard, this);
         }
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         break;
 
@@ -286,7 +286,7 @@ void DPadEditDialog::implementPresets(int index)
 
 void DPadEditDialog::implementModes(int index)
 {
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     dpad->releaseButtonEvents();
 
@@ -309,7 +309,7 @@ void DPadEditDialog::implementModes(int index)
         break;
     }
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 }
 
 void DPadEditDialog::selectCurrentPreset()
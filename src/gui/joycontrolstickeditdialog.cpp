@@ -23,6 +23,7 @@
 #include "buttoneditdialog.h"
 #include "common.h"
 #include "event.h"
+#include "guitelemetry.h"
 #include "inputdevice.h"
 #include "joybuttontypes/joycontrolstickbutton.h"
 #include "joybuttontypes/joycontrolstickmodifierbutton.h"
@@ -51,7 +52,7 @@ JoyControlStickEditDialog::JoyControlStickEditDialog(JoyControlStick *stick, boo
     this->stick = stick;
     getHelperLocal().moveToThread(stick->thread());
 
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     updateWindowTitleStickName();
 
@@ -131,7 +132,7 @@ JoyControlStickEditDialog::JoyControlStickEditDialog(JoyControlStick *stick, boo
     update();
     updateGeometry();
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 
     connect(ui->presetsComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this,
             &JoyControlStickEditDialog::implementPresets);
@@ -166,7 +167,12 @@ JoyControlStickEditDialog::JoyControlStickEditDialog(JoyControlStick *stick, boo
     connect(ui->stickDelayDoubleSpinBox, static_cast<void (QDoubleSpinBox::*)(double)>(&QDoubleSpinBox::valueChanged), this,
             &JoyControlStickEditDialog::updateStickDelaySlider);
 
-    connect(stick, &JoyControlStick::moved, this, &JoyControlStickEditDialog::refreshStickStats);
+    GuiTelemetry::getInstance()->watch(this);
+    connect(GuiTelemetry::getInstance(), &GuiTelemetry::stickMoved, this,
+            [this](JoyControlStick *movedStick, int x, int y) {
+                if (movedStick == stick)
+                    refreshStickStats(x, y);
+            });
     connect(ui->mouseSettingsPushButton, &QPushButton::clicked, this, &JoyControlStickEditDialog::openMouseSettingsDialog);
 
     connect(ui->stickNameLineEdit, &QLineEdit::textEdited, stick, &JoyControlStick::setStickName);
@@ -207,14 +213,14 @@ void JoyControlStickEditDialog::implementPresets(int index)
     switch (index)
     {
     case 1: {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
         leftButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseLeft, JoyButtonSlot::JoyMouseMovement, this);
         rightButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseRight, JoyButtonSlot::JoyMouseMovement, this);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         ui->joyModeComboBox->setCurrentIndex(0);
         ui->diagonalRangeSlider->setValue(65);
@@ -222,14 +228,14 @@ void JoyControlStickEditDialog::implementPresets(int index)
         break;
     }
     case 2: {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
         leftButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseRight, JoyButtonSlot::JoyMouseMovement, this);
         rightButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseLeft, JoyButtonSlot::JoyMouseMovement, this);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         ui->joyModeComboBox->setCurrentIndex(0);
         ui->diagonalRangeSlider->setValue(65);
@@ -237,14 +243,14 @@ void JoyControlStickEditDialog::implementPresets(int index)
         break;
     }
     case 3: {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
         leftButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseLeft, JoyButtonSlot::JoyMouseMovement, this);
         rightButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseRight, JoyButtonSlot::JoyMouseMovement, this);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         ui->joyModeComboBox->setCurrentIndex(0);
         ui->diagonalRangeSlider->setValue(65);
@@ -252,14 +258,14 @@ void JoyControlStickEditDialog::implementPresets(int index)
         break;
     }
     case 4: {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
         leftButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseRight, JoyButtonSlot::JoyMouseMovement, this);
         rightButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseLeft, JoyButtonSlot::JoyMouseMovement, this);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         ui->joyModeComboBox->setCurrentIndex(0);
         ui->diagonalRangeSlider->setValue(65);
@@ -267,7 +273,7 @@ void JoyControlStickEditDialog::implementPresets(int index)
         break;
     }
     case 5: {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(AntKeyMapper::getInstance()->returnVirtualKey(Qt::Key_Up), Qt::Key_Up,
                                          JoyButtonSlot::JoyKeyboard, this);
@@ -278,7 +284,7 @@ void JoyControlStickEditDialog::implementPresets(int index)
         rightButtonSlot = new JoyButtonSlot(AntKeyMapper::getInstance()->returnVirtualKey(Qt::Key_Right), Qt::Key_Right,
                                             JoyButtonSlot::JoyKeyboard, this);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         ui->joyModeComboBox->setCurrentIndex(0);
         ui->diagonalRangeSlider->setValue(45);
@@ -286,7 +292,7 @@ void JoyControlStickEditDialog::implementPresets(int index)
         break;
     }
     case 6: {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(AntKeyMapper::getInstance()->returnVirtualKey(Qt::Key_W), Qt::Key_W,
                                          JoyButtonSlot::JoyKeyboard, this);
@@ -297,7 +303,7 @@ void JoyControlStickEditDialog::implementPresets(int index)
         rightButtonSlot = new JoyButtonSlot(AntKeyMapper::getInstance()->returnVirtualKey(Qt::Key_D), Qt::Key_D,
                                             JoyButtonSlot::JoyKeyboard, this);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         ui->joyModeComboBox->setCurrentIndex(0);
         ui->diagonalRangeSlider->setValue(45);
@@ -305,7 +311,7 @@ void JoyControlStickEditDialog::implementPresets(int index)
         break;
     }
     case 7: {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         if ((ui->joyModeComboBox->currentIndex() == 0) || (ui->joyModeComboBox->currentIndex() == 2))
         {
@@ -354,7 +360,7 @@ void JoyControlStickEditDialog::implementPresets(int index)
                                   QtKeyMapperBase::AntKey_KP_3, JoyButtonSlot::JoyKeyboard, this);
         }
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         ui->diagonalRangeSlider->setValue(45);
 
@@ -394,7 +400,7 @@ void JoyControlStickEditDialog::refreshStickStats(int x, int y)
     Q_UNUSED(x);
     Q_UNUSED(y);
 
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     QString xCoorString = QString::number(stick->getXCoordinate());
     if (stick->getCircleAdjust() > 0.0)
@@ -416,7 +422,7 @@ void JoyControlStickEditDialog::refreshStickStats(int x, int y)
     double validDistance = stick->getDistanceFromDeadZone() * 100.0;
     ui->fromSafeZoneValueLabel->setText(QString::number(validDistance));
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 }
 
 void JoyControlStickEditDialog::checkMaxZone(int value)
@@ -429,7 +435,7 @@ void JoyControlStickEditDialog::checkMaxZone(int value)
 
 void JoyControlStickEditDialog::implementModes(int index)
 {
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     stick->releaseButtonEvents();
 
@@ -465,7 +471,7 @@ void JoyControlStickEditDialog::implementModes(int index)
     }
     }
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 }
 
 void JoyControlStickEditDialog::selectCurrentPreset()
@@ -568,7 +574,7 @@ void JoyControlStickEditDialog::selectCurrentPreset()
 
 void JoyControlStickEditDialog::updateMouseMode(int index)
 {
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     if (index == 1)
     {
@@ -578,7 +584,7 @@ void JoyControlStickEditDialog::updateMouseMode(int index)
         stick->setButtonsMouseMode(JoyButton::MouseSpring);
     }
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 }
 
 void JoyControlStickEditDialog::openMouseSettingsDialog()
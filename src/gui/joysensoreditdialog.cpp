@@ -22,8 +22,10 @@
 #include "buttoneditdialog.h"
 #include "common.h"
 #include "event.h"
+#include "guitelemetry.h"
 #include "inputdevice.h"
 #include "joybuttontypes/joysensorbutton.h"
+#include "joygyroscopesensor.h"
 #include "joysensor.h"
 #include "mousedialog/mousesensorsettingsdialog.h"
 #include "setjoystick.h"
@@ -60,7 +62,7 @@ JoySensorEditDialog::JoySensorEditDialog(JoySensor *sensor, QWidget *parent)
     }
     m_ui->presetsComboBox->setCurrentIndex(current_preset_index);
 
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     updateWindowTitleSensorName();
     if (m_sensor->getType() == ACCELEROMETER)
@@ -73,6 +75,7 @@ JoySensorEditDialog::JoySensorEditDialog(JoySensor *sensor, QWidget *parent)
         m_ui->rollValue->setText(QString::number(value));
         m_ui->maxZoneSlider->setMaximum(GlobalVariables::JoySensor::ACCEL_MAX);
         m_ui->maxZoneSpinBox->setMaximum(GlobalVariables::JoySensor::ACCEL_MAX);
+        m_ui->gyroMouseGroupBox->setVisible(false);
     } else
     {
         m_ui->xCoordinateLabel->setText(tr("Roll (°/s)"));
@@ -86,6 +89,23 @@ JoySensorEditDialog::JoySensorEditDialog(JoySensor *sensor, QWidget *parent)
         m_ui->rollValue->setVisible(false);
         m_ui->maxZoneSlider->setMaximum(GlobalVariables::JoySensor::GYRO_MAX);
         m_ui->maxZoneSpinBox->setMaximum(GlobalVariables::JoySensor::GYRO_MAX);
+
+        JoyGyroscopeSensor *gyroscope = static_cast<JoyGyroscopeSensor *>(m_sensor);
+        m_ui->gyroMouseCurveComboBox->addItem(tr("Linear"), GyroMouse::LINEAR_CURVE);
+        m_ui->gyroMouseCurveComboBox->addItem(tr("Quadratic"), GyroMouse::QUADRATIC_CURVE);
+        m_ui->gyroMouseCurveComboBox->addItem(tr("Cubic"), GyroMouse::CUBIC_CURVE);
+        m_ui->gyroMouseCurveComboBox->addItem(tr("Enhanced Precision"), GyroMouse::PRECISION_CURVE);
+        m_ui->gyroMouseSpaceComboBox->addItem(tr("Local"), GyroMouse::LOCAL_SPACE);
+        m_ui->gyroMouseSpaceComboBox->addItem(tr("Player"), GyroMouse::PLAYER_SPACE);
+        m_ui->gyroMouseSpaceComboBox->addItem(tr("World"), GyroMouse::WORLD_SPACE);
+
+        m_ui->gyroMouseGroupBox->setChecked(gyroscope->isGyroMouseEnabled());
+        m_ui->gyroMouseSensitivitySpinBox->setValue(gyroscope->getGyroMouseSensitivity());
+        m_ui->gyroMouseCurveComboBox->setCurrentIndex(
+            m_ui->gyroMouseCurveComboBox->findData(gyroscope->getGyroMouseCurve()));
+        m_ui->gyroMouseSpaceComboBox->setCurrentIndex(
+            m_ui->gyroMouseSpaceComboBox->findData(gyroscope->getGyroMouseSpace()));
+        m_ui->gyroMouseSmoothingSpinBox->setValue(gyroscope->getGyroMouseSmoothing());
     }
 
     m_ui->deadZoneSlider->setValue(m_sensor->getDeadZone());
@@ -119,7 +139,7 @@ JoySensorEditDialog::JoySensorEditDialog(JoySensor *sensor, QWidget *parent)
     update();
     updateGeometry();
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 
     connect(m_ui->presetsComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this,
             &JoySensorEditDialog::implementPresets);
@@ -147,10 +167,35 @@ JoySensorEditDialog::JoySensorEditDialog(JoySensor *sensor, QWidget *parent)
     connect(m_ui->sensorDelayDoubleSpinBox, static_cast<void (QDoubleSpinBox::*)(double)>(&QDoubleSpinBox::valueChanged),
             this, &JoySensorEditDialog::setSensorDelay);
 
-    connect(m_sensor, &JoySensor::moved, this, &JoySensorEditDialog::updateSensorStats);
+    GuiTelemetry::getInstance()->watch(this);
+    connect(GuiTelemetry::getInstance(), &GuiTelemetry::sensorMoved, this,
+            [this](JoySensor *movedSensor, float x, float y, float z) {
+                if (movedSensor == m_sensor)
+                    updateSensorStats(x, y, z);
+            });
     connect(m_ui->mouseSettingsPushButton, &QPushButton::clicked, this, &JoySensorEditDialog::openMouseSettingsDialog);
 
     connect(m_ui->sensorNameLineEdit, &QLineEdit::textEdited, m_sensor, &JoySensor::setSensorName);
+
+    if (m_sensor->getType() == GYROSCOPE)
+    {
+        JoyGyroscopeSensor *gyroscope = static_cast<JoyGyroscopeSensor *>(m_sensor);
+        connect(m_ui->gyroMouseGroupBox, &QGroupBox::toggled, gyroscope, &JoyGyroscopeSensor::setGyroMouseEnabled);
+        connect(m_ui->gyroMouseSensitivitySpinBox,
+                static_cast<void (QDoubleSpinBox::*)(double)>(&QDoubleSpinBox::valueChanged), gyroscope,
+                &JoyGyroscopeSensor::setGyroMouseSensitivity);
+        // The combo box items are in enum order and the lambdas run on the
+        // thread of the sensor, so they must not touch the widgets.
+        connect(m_ui->gyroMouseCurveComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged),
+                gyroscope,
+                [gyroscope](int index) { gyroscope->setGyroMouseCurve(static_cast<GyroMouse::Curve>(index)); });
+        connect(m_ui->gyroMouseSpaceComboBox, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged),
+                gyroscope,
+                [gyroscope](int index) { gyroscope->setGyroMouseSpace(static_cast<GyroMouse::Space>(index)); });
+        connect(m_ui->gyroMouseSmoothingSpinBox,
+                static_cast<void (QDoubleSpinBox::*)(double)>(&QDoubleSpinBox::valueChanged), gyroscope,
+                &JoyGyroscopeSensor::setGyroMouseSmoothing);
+    }
     connect(m_sensor, &JoySensor::sensorNameChanged, this, &JoySensorEditDialog::updateWindowTitleSensorName);
 }
 
@@ -21,6 +21,7 @@
 
 #include "common.h"
 #include "globalvariables.h"
+#include "guitelemetry.h"
 #include "inputdevice.h"
 #include "joybuttonstatusbox.h"
 #include "joybuttontypes/joydpadbutton.h"
@@ -45,7 +46,10 @@ JoystickStatusWindow::JoystickStatusWindow(InputDevice *joystick, QWidget *paren
 
     this->joystick = joystick;
 
-    PadderCommon::inputDaemonMutex.lock();
+    // Axis and sensor values are taken from GuiTelemetry at display refresh rate.
+    GuiTelemetry::getInstance()->watch(this);
+
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     setWindowTitle(tr("%1 (#%2) Properties").arg(joystick->getSDLName()).arg(joystick->getRealJoyNumber()));
 
@@ -132,7 +136,11 @@ JoystickStatusWindow::JoystickStatusWindow(InputDevice *joystick, QWidget *paren
             hbox->addSpacing(10);
             axesBox->addLayout(hbox);
 
-            connect(axis, &JoyAxis::moved, axisBar, &QProgressBar::setValue);
+            connect(GuiTelemetry::getInstance(), &GuiTelemetry::axisMoved, axisBar,
+                    [axis, axisBar](JoyAxis *movedAxis, int value) {
+                        if (movedAxis == axis)
+                            axisBar->setValue(value);
+                    });
         }
     }
 
@@ -249,13 +257,16 @@ JoystickStatusWindow::JoystickStatusWindow(InputDevice *joystick, QWidget *paren
                 sensorsBox->addLayout(hbox);
             }
 
-            if (type == ACCELEROMETER)
-            {
-                connect(sensor, &JoySensor::moved, this, &JoystickStatusWindow::updateAccelerometerValues);
-            } else
-            {
-                connect(sensor, &JoySensor::moved, this, &JoystickStatusWindow::updateGyroscopeValues);
-            }
+            connect(GuiTelemetry::getInstance(), &GuiTelemetry::sensorMoved, this,
+                    [this, sensor, type](JoySensor *movedSensor, float x, float y, float z) {
+                        if (movedSensor != sensor)
+                            return;
+
+                        if (type == ACCELEROMETER)
+                            updateAccelerometerValues(x, y, z);
+                        else
+                            updateGyroscopeValues(x, y, z);
+                    });
         }
     }
 
@@ -296,7 +307,7 @@ JoystickStatusWindow::JoystickStatusWindow(InputDevice *joystick, QWidget *paren
 
     ui->sdlGameControllerLabel->setText(usingGameController);
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 
     connect(joystick, &InputDevice::destroyed, this, &JoystickStatusWindow::obliterate);
     connect(this, &JoystickStatusWindow::finished, this, &JoystickStatusWindow::restoreButtonStates);
@@ -308,12 +319,12 @@ void JoystickStatusWindow::restoreButtonStates(int code)
 {
     if (code == QDialogButtonBox::AcceptRole)
     {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         joystick->getActiveSetJoystick()->setIgnoreEventState(false);
         joystick->getActiveSetJoystick()->release();
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
     }
 }
 
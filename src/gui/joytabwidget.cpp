@@ -509,6 +509,7 @@ JoyTabWidget::JoyTabWidget(InputDevice *joystick, AntiMicroSettings *settings, Q
     connect(joystick, &InputDevice::profileUpdated, this, &JoyTabWidget::displayProfileEditNotification);
 
     connect(joystick, &InputDevice::requestProfileLoad, this, &JoyTabWidget::loadConfigFile, Qt::QueuedConnection);
+    connect(&tabHelper, &JoyTabWidgetHelper::writeFailed, this, &JoyTabWidget::profileWriteFailed, Qt::QueuedConnection);
 
     reconnectCheckUnsavedEvent();
     reconnectMainComboBoxEvents();
@@ -660,22 +661,24 @@ void JoyTabWidget::saveConfigFile()
     {
         QFileInfo fileinfo(filename);
 
-        QMetaObject::invokeMethod(&tabHelper, "writeConfigFile", Qt::BlockingQueuedConnection,
-                                  Q_ARG(QString, fileinfo.absoluteFilePath()));
-        XMLConfigWriter *writer = tabHelper.getWriter();
+        // Saving runs in the background, failures after this check are
+        // reported through profileWriteFailed().
+        QString writeError = XMLConfigWriter::checkWritable(fileinfo.absoluteFilePath());
 
-        if (writer->hasError() && this->window()->isEnabled())
+        if (!writeError.isEmpty() && this->window()->isEnabled())
         {
             QMessageBox msg;
             msg.setStandardButtons(QMessageBox::Close);
-            msg.setText(writer->getErrorString());
+            msg.setText(writeError);
             msg.setModal(true);
             msg.exec();
-        } else if (writer->hasError() && !this->window()->isEnabled())
+        } else if (!writeError.isEmpty() && !this->window()->isEnabled())
         {
-            PRINT_STDERR() << writer->getErrorString() << "\n";
+            PRINT_STDERR() << writeError << "\n";
         } else
         {
+            tabHelper.scheduleWriteConfigFile(fileinfo.absoluteFilePath());
+
             int existingIndex = configBox->findData(fileinfo.absoluteFilePath());
 
             if (existingIndex == -1)
@@ -835,22 +838,24 @@ void JoyTabWidget::saveAsConfig()
         }
         fileinfo.setFile(filename);
 
-        QMetaObject::invokeMethod(&tabHelper, "writeConfigFile", Qt::BlockingQueuedConnection,
-                                  Q_ARG(QString, fileinfo.absoluteFilePath()));
-        XMLConfigWriter *writer = tabHelper.getWriter();
+        // Saving runs in the background, failures after this check are
+        // reported through profileWriteFailed().
+        QString writeError = XMLConfigWriter::checkWritable(fileinfo.absoluteFilePath());
 
-        if (writer->hasError() && this->window()->isEnabled())
+        if (!writeError.isEmpty() && this->window()->isEnabled())
         {
             QMessageBox msg;
             msg.setStandardButtons(QMessageBox::Close);
-            msg.setText(writer->getErrorString());
+            msg.setText(writeError);
             msg.setModal(true);
             msg.exec();
-        } else if (writer->hasError() && !this->window()->isEnabled())
+        } else if (!writeError.isEmpty() && !this->window()->isEnabled())
         {
-            PRINT_STDERR() << writer->getErrorString() << "\n";
+            PRINT_STDERR() << writeError << "\n";
         } else
         {
+            tabHelper.scheduleWriteConfigFile(fileinfo.absoluteFilePath());
+
             int existingIndex = configBox->findData(fileinfo.absoluteFilePath());
             if (existingIndex == -1)
             {
@@ -1568,6 +1573,38 @@ void JoyTabWidget::refreshSetButtons()
     }
 }
 
+/**
+ * @brief Profiles are written in the background after the save was already
+ *  shown as done. Marks the profile as edited again if that failed.
+ */
+void JoyTabWidget::profileWriteFailed(QString filepath)
+{
+    int index = configBox->findData(filepath);
+
+    if (index == configBox->currentIndex())
+        m_joystick->profileEdited();
+
+    if (index != -1)
+        configBox->setItemIcon(index,
+                               PadderCommon::loadIcon("document-save-as", ":/images/actions/document_save_as.png"));
+
+    changedNotSaved = true;
+
+    QString errorString = tr("Could not write to profile at %1.").arg(filepath);
+
+    if (this->window()->isEnabled())
+    {
+        QMessageBox msg;
+        msg.setStandardButtons(QMessageBox::Close);
+        msg.setText(errorString);
+        msg.setModal(true);
+        msg.exec();
+    } else
+    {
+        PRINT_STDERR() << errorString << "\n";
+    }
+}
+
 void JoyTabWidget::displayProfileEditNotification()
 {
     int currentIndex = configBox->currentIndex();
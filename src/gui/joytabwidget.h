@@ -120,6 +120,7 @@ class JoyTabWidget : public QWidget
     void showSetNamesDialog(); // JoyTabWidgetSets class
     void toggleNames();
     void updateBatteryIcon();
+    void profileWriteFailed(QString filepath);
 
     void changeSetOne();   // JoyTabWidgetSets class
     void changeSetTwo();   // JoyTabWidgetSets class
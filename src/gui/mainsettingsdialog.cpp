@@ -27,6 +27,7 @@
 #include "eventhandlerfactory.h"
 #include "globalvariables.h"
 #include "inputdevice.h"
+#include "mouseoutputthread.h"
 
 #ifdef WITH_X11
     #include "x11extras.h"
@@ -247,6 +248,21 @@ MainSettingsDialog::MainSettingsDialog(AntiMicroSettings *settings, QList<InputD
         ui->mouseRefreshRateComboBox->setCurrentIndex(refreshIndex);
     }
 
+    ui->mouseOutputRateComboBox->addItem(tr("Off"), 0);
+
+    for (int rate = MouseOutputThread::MINIMUM_RATE; rate <= MouseOutputThread::MAXIMUM_RATE; rate *= 2)
+    {
+        ui->mouseOutputRateComboBox->addItem(tr("%1 Hz").arg(rate), rate);
+    }
+
+    int outputIndex = ui->mouseOutputRateComboBox->findData(MouseOutputThread::getRate());
+    if (outputIndex >= 0)
+    {
+        ui->mouseOutputRateComboBox->setCurrentIndex(outputIndex);
+    }
+
+    ui->mouseHighResolutionCheckBox->setChecked(GlobalVariables::JoyButton::highResolutionMouse);
+
 #ifdef Q_OS_WIN
     QString tempTooltip = ui->mouseRefreshRateComboBox->toolTip();
     tempTooltip.append("\n\n");
@@ -269,6 +285,12 @@ MainSettingsDialog::MainSettingsDialog(AntiMicroSettings *settings, QList<InputD
         ui->gamepadPollRateComboBox->setCurrentIndex(gamepadPollIndex);
     }
 
+    ui->gamepadWaitForEventsCheckBox->setChecked(GlobalVariables::JoyButton::gamepadWaitForEvents);
+    bool threadPerDevice =
+        settings->value("GamepadThreadPerDevice", GlobalVariables::AntimicroSettings::defaultGamepadThreadPerDevice)
+            .toBool();
+    ui->gamepadThreadPerDeviceCheckBox->setChecked(threadPerDevice);
+
     if (QApplication::platformName() == QStringLiteral("xcb"))
     {
         refreshExtraMouseInfo();
@@ -688,6 +710,21 @@ void MainSettingsDialog::saveNewSettings()
                                        JoyButton::getStaticMouseEventTimer());
     }
 
+    int outputIndex = ui->mouseOutputRateComboBox->currentIndex();
+    int mouseOutputRate = ui->mouseOutputRateComboBox->itemData(outputIndex).toInt();
+    if (mouseOutputRate != MouseOutputThread::getRate())
+    {
+        settings->setValue("Mouse/OutputRate", mouseOutputRate);
+        MouseOutputThread::setRate(mouseOutputRate);
+    }
+
+    bool highResolutionMouse = ui->mouseHighResolutionCheckBox->isChecked();
+    if (highResolutionMouse != GlobalVariables::JoyButton::highResolutionMouse)
+    {
+        settings->setValue("Mouse/HighResolution", highResolutionMouse);
+        GlobalVariables::JoyButton::highResolutionMouse = highResolutionMouse;
+    }
+
     int springIndex = ui->springScreenComboBox->currentIndex();
     int springScreen = ui->springScreenComboBox->itemData(springIndex).toInt();
     JoyButton::setSpringModeScreen(springScreen, GlobalVariables::JoyButton::springModeScreen);
@@ -702,6 +739,16 @@ void MainSettingsDialog::saveNewSettings()
         settings->setValue("GamepadPollRate", QString::number(gamepadPollRate));
     }
 
+    bool gamepadWaitForEvents = ui->gamepadWaitForEventsCheckBox->isChecked();
+    if (gamepadWaitForEvents != GlobalVariables::JoyButton::gamepadWaitForEvents)
+    {
+        JoyButton::setGamepadWaitForEvents(gamepadWaitForEvents, GlobalVariables::JoyButton::gamepadWaitForEvents,
+                                           JoyButton::getMouseHelper());
+        settings->setValue("GamepadWaitForEvents", gamepadWaitForEvents);
+    }
+
+    settings->setValue("GamepadThreadPerDevice", ui->gamepadThreadPerDeviceCheckBox->isChecked());
+
     // Advanced Tab
     settings->setValue("LogFile", ui->logFilePathEdit->text());
     int logLevel = ui->logLevelComboBox->currentIndex();
@@ -1920,6 +1967,8 @@ void MainSettingsDialog::resetGeneralSett()
         ui->gamepadPollRateComboBox->setCurrentIndex(gamepadPollIndex);
     }
 
+    ui->gamepadWaitForEventsCheckBox->setChecked(false);
+    ui->gamepadThreadPerDeviceCheckBox->setChecked(GlobalVariables::AntimicroSettings::defaultGamepadThreadPerDevice);
     ui->closeToTrayCheckBox->setChecked(false);
     ui->attachNumKeypadCheckbox->setChecked(false);
     ui->launchAtWinStartupCheckBox->setChecked(false);
@@ -2001,6 +2050,10 @@ void MainSettingsDialog::resetMouseSett()
         ui->mouseRefreshRateComboBox->setCurrentIndex(refreshIndex);
     }
 
+    ui->mouseOutputRateComboBox->setCurrentIndex(
+        ui->mouseOutputRateComboBox->findData(GlobalVariables::AntimicroSettings::defaultMouseOutputRate));
+    ui->mouseHighResolutionCheckBox->setChecked(GlobalVariables::AntimicroSettings::defaultHighResolutionMouse);
+
     int screenIndex = ui->springScreenComboBox->findData(GlobalVariables::JoyButton::springModeScreen);
 
     if (screenIndex > -1)
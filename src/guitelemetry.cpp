@@ -0,0 +1,207 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "guitelemetry.h"
+
+#include <QCoreApplication>
+#include <QEvent>
+#include <QGuiApplication>
+#include <QMutexLocker>
+#include <QScreen>
+#include <QWidget>
+
+GuiTelemetry *GuiTelemetry::instance = nullptr;
+std::atomic<bool> GuiTelemetry::collecting(false);
+QMutex GuiTelemetry::bufferMutex;
+
+GuiTelemetry::GuiTelemetry(QObject *parent)
+    : QObject(parent)
+    , m_back(&m_buffers[0])
+    , m_front(&m_buffers[1])
+{
+    qreal refreshRate = 60.0;
+    QScreen *screen = QGuiApplication::primaryScreen();
+
+    if ((screen != nullptr) && (screen->refreshRate() > 1.0))
+        refreshRate = screen->refreshRate();
+
+    m_publish_timer.setParent(this);
+    m_publish_timer.setInterval(qMax(1, qRound(1000.0 / refreshRate)));
+    connect(&m_publish_timer, &QTimer::timeout, this, &GuiTelemetry::publish);
+}
+
+GuiTelemetry::~GuiTelemetry()
+{
+    // The input thread may have checked collecting already.
+    QMutexLocker locker(&bufferMutex);
+    collecting.store(false);
+    instance = nullptr;
+}
+
+/**
+ * @brief Has to be called from the GUI thread first.
+ */
+GuiTelemetry *GuiTelemetry::getInstance()
+{
+    if (instance == nullptr)
+    {
+        GuiTelemetry *telemetry = new GuiTelemetry(qApp);
+        QMutexLocker locker(&bufferMutex);
+        instance = telemetry;
+    }
+
+    return instance;
+}
+
+/**
+ * @brief Values are collected and published while the widget is visible.
+ *  The widget is forgotten when it gets destroyed.
+ */
+void GuiTelemetry::watch(QWidget *widget)
+{
+    widget->installEventFilter(this);
+    connect(widget, &QObject::destroyed, this, [this](QObject *watcher) { setWatcherVisible(watcher, false); });
+
+    if (widget->isVisible())
+        setWatcherVisible(widget, true);
+}
+
+bool GuiTelemetry::eventFilter(QObject *watched, QEvent *event)
+{
+    if (event->type() == QEvent::Show)
+        setWatcherVisible(watched, true);
+    else if (event->type() == QEvent::Hide)
+        setWatcherVisible(watched, false);
+
+    return QObject::eventFilter(watched, event);
+}
+
+void GuiTelemetry::setWatcherVisible(QObject *watcher, bool visible)
+{
+    if (visible)
+        m_visible_watchers.insert(watcher);
+    else
+        m_visible_watchers.remove(watcher);
+
+    if (!m_visible_watchers.isEmpty() && !m_publish_timer.isActive())
+    {
+        collecting.store(true);
+        m_publish_timer.start();
+    } else if (m_visible_watchers.isEmpty() && m_publish_timer.isActive())
+    {
+        collecting.store(false);
+        m_publish_timer.stop();
+
+        // Objects may be deleted while nothing is watched.
+        QMutexLocker locker(&bufferMutex);
+        m_back->clear();
+        m_front->clear();
+    }
+}
+
+void GuiTelemetry::publishAxis(JoyAxis *axis, int value)
+{
+    if (!collecting.load(std::memory_order_acquire))
+        return;
+
+    QMutexLocker locker(&bufferMutex);
+
+    if (instance != nullptr)
+    {
+        Entry<int> &entry = instance->m_back->axes[axis];
+        entry.value = value;
+        entry.changed = true;
+    }
+}
+
+void GuiTelemetry::publishStick(JoyControlStick *stick, int x, int y)
+{
+    if (!collecting.load(std::memory_order_acquire))
+        return;
+
+    QMutexLocker locker(&bufferMutex);
+
+    if (instance != nullptr)
+    {
+        Entry<QPoint> &entry = instance->m_back->sticks[stick];
+        entry.value = QPoint(x, y);
+        entry.changed = true;
+    }
+}
+
+void GuiTelemetry::publishSensor(JoySensor *sensor, float x, float y, float z)
+{
+    if (!collecting.load(std::memory_order_acquire))
+        return;
+
+    QMutexLocker locker(&bufferMutex);
+
+    if (instance != nullptr)
+    {
+        Entry<QVector3D> &entry = instance->m_back->sensors[sensor];
+        entry.value = QVector3D(x, y, z);
+        entry.changed = true;
+    }
+}
+
+/**
+ * @brief Emits the latest value of every object which changed since the
+ *  previous refresh.
+ */
+void GuiTelemetry::publish()
+{
+    {
+        QMutexLocker locker(&bufferMutex);
+        std::swap(m_back, m_front);
+    }
+
+    // Entries stay in place and are only marked as published, so the
+    // buffer can be reused by the input thread without allocating.
+    for (auto iter = m_front->axes.begin(); iter != m_front->axes.end(); ++iter)
+    {
+        if (iter.value().changed)
+        {
+            iter.value().changed = false;
+            emit axisMoved(iter.key(), iter.value().value);
+        }
+    }
+
+    for (auto iter = m_front->sticks.begin(); iter != m_front->sticks.end(); ++iter)
+    {
+        if (iter.value().changed)
+        {
+            iter.value().changed = false;
+            emit stickMoved(iter.key(), iter.value().value.x(), iter.value().value.y());
+        }
+    }
+
+    for (auto iter = m_front->sensors.begin(); iter != m_front->sensors.end(); ++iter)
+    {
+        if (iter.value().changed)
+        {
+            iter.value().changed = false;
+            emit sensorMoved(iter.key(), iter.value().value.x(), iter.value().value.y(), iter.value().value.z());
+        }
+    }
+}
+
+void GuiTelemetry::Snapshot::clear()
+{
+    axes.clear();
+    sticks.clear();
+    sensors.clear();
+}
@@ -0,0 +1,107 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef GUITELEMETRY_H
+#define GUITELEMETRY_H
+
+#include <QHash>
+#include <QMutex>
+#include <QObject>
+#include <QPoint>
+#include <QSet>
+#include <QTimer>
+#include <QVector3D>
+
+#include <atomic>
+
+class JoyAxis;
+class JoyControlStick;
+class JoySensor;
+class QWidget;
+
+/**
+ * @brief Collects raw input values for status widgets.
+ *  The input thread only overwrites the latest value of each axis, stick
+ *  and sensor in a back buffer. Entries are kept once an object was seen and
+ *  only flagged as changed, so publishing does not allocate after the first
+ *  value of each object. The GUI thread swaps the buffers at display
+ *  refresh rate and emits one signal per changed object, so high rate
+ *  devices like gyroscopes do not flood the GUI event queue with queued
+ *  "moved" signals. Nothing is collected while no watched widget is visible.
+ *  Lives in the GUI thread.
+ */
+class GuiTelemetry : public QObject
+{
+    Q_OBJECT
+
+  public:
+    ~GuiTelemetry();
+
+    static GuiTelemetry *getInstance();
+
+    void watch(QWidget *widget);
+
+    // Input thread side
+    static void publishAxis(JoyAxis *axis, int value);
+    static void publishStick(JoyControlStick *stick, int x, int y);
+    static void publishSensor(JoySensor *sensor, float x, float y, float z);
+
+  signals:
+    void axisMoved(JoyAxis *axis, int value);
+    void stickMoved(JoyControlStick *stick, int x, int y);
+    void sensorMoved(JoySensor *sensor, float x, float y, float z);
+
+  protected:
+    bool eventFilter(QObject *watched, QEvent *event) override;
+
+  private slots:
+    void publish();
+
+  private:
+    explicit GuiTelemetry(QObject *parent = nullptr);
+
+    template <typename T> struct Entry
+    {
+        T value = T();
+        bool changed = false;
+    };
+
+    struct Snapshot
+    {
+        QHash<JoyAxis *, Entry<int>> axes;
+        QHash<JoyControlStick *, Entry<QPoint>> sticks;
+        QHash<JoySensor *, Entry<QVector3D>> sensors;
+
+        void clear();
+    };
+
+    void setWatcherVisible(QObject *watcher, bool visible);
+
+    static GuiTelemetry *instance;
+    static std::atomic<bool> collecting;
+    // Guards instance and the back buffer.
+    static QMutex bufferMutex;
+
+    Snapshot m_buffers[2];
+    Snapshot *m_back;
+    Snapshot *m_front;
+
+    QSet<QObject *> m_visible_watchers;
+    QTimer m_publish_timer;
+};
+
+#endif // GUITELEMETRY_H
@@ -0,0 +1,262 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _USE_MATH_DEFINES
+
+#include "gyromouse.h"
+
+#include "globalvariables.h"
+
+#include <QtGlobal>
+
+#include <cmath>
+
+const GyroMouse::Curve GyroMouse::DEFAULTCURVE = GyroMouse::LINEAR_CURVE;
+const GyroMouse::Space GyroMouse::DEFAULTSPACE = GyroMouse::PLAYER_SPACE;
+
+// Below this length in m/s^2 the gravity vector is not trusted and
+// local space is used instead.
+const double GyroMouse::MIN_GRAVITY = 1.0;
+// Lets player space use a bit more of the yaw/roll plane than the exact
+// projection onto the gravity vector, so turning stays natural while the
+// controller is tilted.
+const double GyroMouse::PLAYER_YAW_RELAX = 1.41;
+// Longest time in nominal sample periods a sample is integrated over.
+// A pause of the sensor does not turn into a jump of the cursor.
+const double GyroMouse::MAX_SAMPLE_PERIODS = 4.0;
+
+GyroMouse::GyroMouse(double rate)
+    : m_rate(qFuzzyIsNull(rate) ? PT1Filter::FALLBACK_RATE : rate)
+    , m_sensitivity(GlobalVariables::JoySensor::DEFAULTGYROMOUSESENSITIVITY)
+    , m_curve(DEFAULTCURVE)
+    , m_space(DEFAULTSPACE)
+    , m_smoothing(0)
+    , m_last_timestamp(0)
+    , m_pending_x(0)
+    , m_pending_y(0)
+{
+    setSmoothing(GlobalVariables::JoySensor::DEFAULTGYROMOUSESMOOTHING);
+}
+
+/**
+ * @brief Integrates one calibrated gyroscope sample.
+ * @param[in] angularVelocity Angular velocity around the X, Y and Z axes in rad/s
+ * @param[in] gravity Low pass filtered acceleration in m/s^2 or nullptr if
+ *  there is no accelerometer
+ * @param[in] maxSpeed Angular velocity in rad/s at which the sensitivity
+ *  curve reaches its end. It continues linearly above.
+ * @param[in] timestampUs Sensor timestamp of the sample in µs, 0 if unknown.
+ *  Samples without timestamp are integrated over one nominal sample period.
+ */
+void GyroMouse::processSample(const float *angularVelocity, const double *gravity, double maxSpeed, quint64 timestampUs)
+{
+    double dt = 1.0 / m_rate;
+
+    if ((timestampUs != 0) && (m_last_timestamp != 0) && (timestampUs >= m_last_timestamp))
+        dt = qMin((timestampUs - m_last_timestamp) / 1000000.0, MAX_SAMPLE_PERIODS / m_rate);
+
+    if (timestampUs != 0)
+        m_last_timestamp = timestampUs;
+
+    double yaw = angularVelocity[1];
+    double pitch = angularVelocity[0];
+    double length = 0;
+
+    if (gravity != nullptr)
+        length = sqrt(gravity[0] * gravity[0] + gravity[1] * gravity[1] + gravity[2] * gravity[2]);
+
+    if ((m_space != LOCAL_SPACE) && (length >= MIN_GRAVITY))
+    {
+        // The accelerometer measures the reaction to gravity,
+        // so this vector points up.
+        double up[3] = {gravity[0] / length, gravity[1] / length, gravity[2] / length};
+
+        if (m_space == WORLD_SPACE)
+        {
+            yaw = angularVelocity[0] * up[0] + angularVelocity[1] * up[1] + angularVelocity[2] * up[2];
+
+            // Pitch around the X axis of the controller projected onto the horizontal plane.
+            double side[3] = {1 - up[0] * up[0], -up[0] * up[1], -up[0] * up[2]};
+            double sideLength = sqrt(side[0] * side[0] + side[1] * side[1] + side[2] * side[2]);
+
+            if (sideLength > 0.001)
+            {
+                pitch = (angularVelocity[0] * side[0] + angularVelocity[1] * side[1] + angularVelocity[2] * side[2]) /
+                        sideLength;
+            }
+        } else
+        {
+            double worldYaw = angularVelocity[1] * up[1] + angularVelocity[2] * up[2];
+            double planeSpeed = sqrt(angularVelocity[1] * angularVelocity[1] + angularVelocity[2] * angularVelocity[2]);
+            yaw = copysign(qMin(fabs(worldYaw) * PLAYER_YAW_RELAX, planeSpeed), worldYaw);
+        }
+    }
+
+    if (m_smoothing > 0)
+    {
+        yaw = m_yaw_filter.process(yaw);
+        pitch = m_pitch_filter.process(pitch);
+    }
+
+    double speed = sqrt(yaw * yaw + pitch * pitch);
+
+    if ((speed > 0) && (maxSpeed > 0))
+    {
+        double normalized = qMin(speed / maxSpeed, 1.0);
+        double gain = applyCurve(normalized) / normalized;
+        yaw *= gain;
+        pitch *= gain;
+    }
+
+    // Positive yaw turns left and positive pitch tilts up,
+    // both are the opposite of the screen axes.
+    double scale = m_sensitivity * 180.0 / M_PI * dt * GlobalVariables::JoyButton::CURSORSUBPIXELS;
+    m_pending_x -= qRound64(yaw * scale);
+    m_pending_y -= qRound64(pitch * scale);
+}
+
+/**
+ * @brief Takes the whole pixels of the integrated movement.
+ *  The remaining fraction stays for the next call.
+ * @return true if there is movement to send
+ */
+bool GyroMouse::takeDelta(int *dx, int *dy)
+{
+    const qint64 subpixels = GlobalVariables::JoyButton::CURSORSUBPIXELS;
+    *dx = static_cast<int>(m_pending_x / subpixels);
+    *dy = static_cast<int>(m_pending_y / subpixels);
+    m_pending_x -= *dx * subpixels;
+    m_pending_y -= *dy * subpixels;
+
+    return (*dx != 0) || (*dy != 0);
+}
+
+/**
+ * @brief Drops the filter state and any movement which was not taken yet.
+ */
+void GyroMouse::reset()
+{
+    m_yaw_filter.reset();
+    m_pitch_filter.reset();
+    m_last_timestamp = 0;
+    m_pending_x = 0;
+    m_pending_y = 0;
+}
+
+/**
+ * @brief Sets the sensitivity in pixels per degree of rotation.
+ */
+void GyroMouse::setSensitivity(double value)
+{
+    if (value > 0)
+        m_sensitivity = value;
+}
+
+void GyroMouse::setCurve(Curve curve) { m_curve = curve; }
+
+void GyroMouse::setSpace(Space space) { m_space = space; }
+
+/**
+ * @brief Sets the smoothing time constant in ms. 0 disables smoothing.
+ */
+void GyroMouse::setSmoothing(double value)
+{
+    if (value < 0)
+        return;
+
+    m_smoothing = value;
+
+    if (value > 0)
+    {
+        m_yaw_filter = PT1Filter(value / 1000.0, m_rate);
+        m_pitch_filter = PT1Filter(value / 1000.0, m_rate);
+    }
+}
+
+QString GyroMouse::curveName(Curve curve)
+{
+    switch (curve)
+    {
+    case QUADRATIC_CURVE:
+        return "quadratic";
+    case CUBIC_CURVE:
+        return "cubic";
+    case PRECISION_CURVE:
+        return "precision";
+    default:
+        return "linear";
+    }
+}
+
+GyroMouse::Curve GyroMouse::curveFromName(const QString &name)
+{
+    if (name == "quadratic")
+        return QUADRATIC_CURVE;
+    else if (name == "cubic")
+        return CUBIC_CURVE;
+    else if (name == "precision")
+        return PRECISION_CURVE;
+    else
+        return LINEAR_CURVE;
+}
+
+QString GyroMouse::spaceName(Space space)
+{
+    switch (space)
+    {
+    case PLAYER_SPACE:
+        return "player";
+    case WORLD_SPACE:
+        return "world";
+    default:
+        return "local";
+    }
+}
+
+GyroMouse::Space GyroMouse::spaceFromName(const QString &name)
+{
+    if (name == "player")
+        return PLAYER_SPACE;
+    else if (name == "world")
+        return WORLD_SPACE;
+    else
+        return LOCAL_SPACE;
+}
+
+/**
+ * @brief Shapes a normalized speed between 0 and 1.
+ *  The precision curve uses the same segments as the one of JoyButton.
+ */
+double GyroMouse::applyCurve(double value) const
+{
+    switch (m_curve)
+    {
+    case QUADRATIC_CURVE:
+        return value * value;
+    case CUBIC_CURVE:
+        return value * value * value;
+    case PRECISION_CURVE:
+        if (value <= 0.4)
+            return value * 0.37;
+        else if (value <= 0.75)
+            return value - 0.252;
+        else
+            return (value * 2.008) - 1.008;
+    default:
+        return value;
+    }
+}
@@ -0,0 +1,104 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pt1filter.h"
+
+#include <QString>
+
+/**
+ * @brief Turns gyroscope samples directly into relative cursor movement.
+ *
+ * Every sample is integrated on its own, so no rotation is lost when several
+ * samples arrive within one input poll. The angular velocity is first taken
+ * into the selected space with the help of the gravity vector measured by the
+ * accelerometer, optionally smoothed, shaped by the sensitivity curve and
+ * finally scaled from degrees to pixels. Each sample is integrated over the
+ * time since the previous one according to the sensor timestamps, so dropped
+ * or merged samples do not change the speed. Movement is accumulated as an
+ * integer count of 1/CURSORSUBPIXELS pixels like the high resolution cursor
+ * output and fractions of a pixel are carried over to the next delta.
+ *
+ * Axes follow the SDL convention: X is pitch, Y is yaw and Z is roll.
+ */
+class GyroMouse
+{
+  public:
+    enum Curve
+    {
+        LINEAR_CURVE = 0,
+        QUADRATIC_CURVE,
+        CUBIC_CURVE,
+        PRECISION_CURVE
+    };
+
+    enum Space
+    {
+        LOCAL_SPACE = 0,
+        PLAYER_SPACE,
+        WORLD_SPACE
+    };
+
+    static const Curve DEFAULTCURVE;
+    static const Space DEFAULTSPACE;
+
+    explicit GyroMouse(double rate = 0);
+
+    void processSample(const float *angularVelocity, const double *gravity, double maxSpeed, quint64 timestampUs = 0);
+    bool takeDelta(int *dx, int *dy);
+    void reset();
+
+    /**
+     * @brief Get the sensitivity in pixels per degree of rotation.
+     */
+    inline double getSensitivity() const { return m_sensitivity; }
+    void setSensitivity(double value);
+    inline Curve getCurve() const { return m_curve; }
+    void setCurve(Curve curve);
+    inline Space getSpace() const { return m_space; }
+    void setSpace(Space space);
+    /**
+     * @brief Get the smoothing time constant in ms. 0 disables smoothing.
+     */
+    inline double getSmoothing() const { return m_smoothing; }
+    void setSmoothing(double value);
+
+    static QString curveName(Curve curve);
+    static Curve curveFromName(const QString &name);
+    static QString spaceName(Space space);
+    static Space spaceFromName(const QString &name);
+
+  private:
+    static const double MIN_GRAVITY;
+    static const double PLAYER_YAW_RELAX;
+    static const double MAX_SAMPLE_PERIODS;
+
+    double applyCurve(double value) const;
+
+    double m_rate;
+    double m_sensitivity;
+    Curve m_curve;
+    Space m_space;
+    double m_smoothing;
+    PT1Filter m_yaw_filter;
+    PT1Filter m_pitch_filter;
+    quint64 m_last_timestamp;
+    // Integrated movement in 1/CURSORSUBPIXELS pixels.
+    qint64 m_pending_x;
+    qint64 m_pending_y;
+};
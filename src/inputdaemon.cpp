@@ -20,13 +20,20 @@
 
 #include "antimicrosettings.h"
 #include "common.h"
+#include "eventhandlerfactory.h"
 #include "globalvariables.h"
 #include "inputdevicebitarraystatus.h"
+#include "inputdeviceworker.h"
 #include "joydpad.h"
 #include "joysensor.h"
 #include "joystick.h"
+#include "latencytracer.h"
 #include "logger.h"
+#include "sdleventhandoff.h"
+#include "sdleventplayer.h"
 #include "sdleventreader.h"
+#include "sdleventrecorder.h"
+#include "sdleventring.h"
 
 #include <QDebug>
 #include <QEventLoop>
@@ -39,6 +46,9 @@ InputDaemon::InputDaemon(QMap<SDL_JoystickID, InputDevice *> *joysticks, AntiMic
                          QObject *parent)
     : QObject(parent)
     , pollResetTimer(this)
+    , replayTimer(this)
+    , eventRecorder(nullptr)
+    , eventPlayer(nullptr)
 {
     m_joysticks = joysticks;
     // Xbox360Wireless* xbox360class = new Xbox360Wireless();
@@ -48,20 +58,44 @@ InputDaemon::InputDaemon(QMap<SDL_JoystickID, InputDevice *> *joysticks, AntiMic
     m_settings = settings;
 
     eventWorker = new SDLEventReader(joysticks, settings);
+    eventHandoff = nullptr;
+
+    // The latency tracer keeps the trace of one event at a time, so devices
+    // stay on the input thread while it is enabled.
+    settings->getLock()->lock();
+    bool threadPerDevice =
+        settings->value("GamepadThreadPerDevice", GlobalVariables::AntimicroSettings::defaultGamepadThreadPerDevice)
+            .toBool();
+    settings->getLock()->unlock();
+
+    m_thread_per_device = m_graphical && threadPerDevice && !LatencyTracer::isEnabled();
+
+    if (m_thread_per_device)
+        connect(this, &InputDaemon::deviceAdded, this, &InputDaemon::createDeviceWorker, Qt::DirectConnection);
+
     refreshJoysticks();
     sdlWorkerThread = nullptr;
 
     if (m_graphical)
     {
+        // Events are passed from the SDL thread through a lock-free queue.
+        // The SDL thread keeps polling on its own, so no signal round trip
+        // is needed to re-arm it after each input cycle.
+        eventHandoff = new SDLEventHandoff(this);
+        eventWorker->setEventHandoff(eventHandoff);
+
         sdlWorkerThread = new QThread;
         sdlWorkerThread->setObjectName("sdlWorkerThread");
         eventWorker->moveToThread(sdlWorkerThread);
 
         connect(sdlWorkerThread, &QThread::started, eventWorker, &SDLEventReader::performWork);
         connect(eventWorker, &SDLEventReader::eventRaised, this, &InputDaemon::run);
+        connect(eventHandoff, &SDLEventHandoff::eventsAvailable, this, &InputDaemon::run);
 
         connect(JoyButton::getMouseHelper(), &JoyButtonMouseHelper::gamepadRefreshRateUpdated, eventWorker,
                 &SDLEventReader::updatePollRate);
+        connect(JoyButton::getMouseHelper(), &JoyButtonMouseHelper::gamepadWaitForEventsUpdated, eventWorker,
+                &SDLEventReader::updateWaitForEvents);
 
         connect(JoyButton::getMouseHelper(), &JoyButtonMouseHelper::gamepadRefreshRateUpdated, this,
                 &InputDaemon::updatePollResetRate);
@@ -76,6 +110,10 @@ InputDaemon::InputDaemon(QMap<SDL_JoystickID, InputDevice *> *joysticks, AntiMic
 
         connect(&pollResetTimer, &QTimer::timeout, this, &InputDaemon::resetActiveButtonMouseDistances);
     }
+
+    // Replayed events do not wake up the daemon on their own.
+    replayTimer.setTimerType(Qt::PreciseTimer);
+    connect(&replayTimer, &QTimer::timeout, this, &InputDaemon::run);
 }
 
 InputDaemon::~InputDaemon()
@@ -90,6 +128,9 @@ InputDaemon::~InputDaemon()
         sdlWorkerThread->deleteLater();
         sdlWorkerThread = nullptr;
     }
+
+    delete eventRecorder;
+    delete eventPlayer;
 }
 
 void InputDaemon::startWorker()
@@ -100,20 +141,26 @@ void InputDaemon::startWorker()
 
 void InputDaemon::run()
 {
-    PadderCommon::inputDaemonMutex.lock();
-
     // SDL has found events. The timeout is not necessary.
     pollResetTimer.stop();
 
     if (!stopped)
     {
+        // Filtering reads the input objects. The lock is not held for the
+        // whole cycle because removing devices and the signals emitted on the
+        // way can reach code which locks it for writing.
+        PadderCommon::inputDaemonLock.lockForRead();
         JoyButton::resetActiveButtonMouseDistances(JoyButton::getMouseHelper());
 
-        QQueue<SDL_Event> sdlEventQueue;
         firstInputPass(&sdlEventQueue);
         modifyUnplugEvents(&sdlEventQueue);
+        PadderCommon::inputDaemonLock.unlock();
+
         secondInputPass(&sdlEventQueue);
         clearBitArrayStatusInstances();
+
+        if ((eventPlayer != nullptr) && eventPlayer->atEnd())
+            stopReplay();
     }
 
     if (stopped)
@@ -125,11 +172,13 @@ void InputDaemon::run()
         stopped = false;
     } else
     {
-        QTimer::singleShot(0, eventWorker, SLOT(performWork()));
+        if (eventHandoff == nullptr)
+            QTimer::singleShot(0, eventWorker, SLOT(performWork()));
+        else if (eventHandoff->hasPendingEvents())
+            QMetaObject::invokeMethod(this, "run", Qt::QueuedConnection); // Event ring was full
+
         pollResetTimer.start();
     }
-
-    PadderCommon::inputDaemonMutex.unlock();
 }
 
 QString InputDaemon::getJoyInfo(SDL_JoystickGUID sdlvalue)
@@ -160,6 +209,8 @@ void InputDaemon::refreshJoysticks()
 
         if (joystick != nullptr)
         {
+            deleteBitArrayStatusInstances(joystick);
+            deviceWorkers.remove(joystick);
             m_joysticks->remove(iter.key());
             joystick->deleteLater();
         }
@@ -288,6 +339,10 @@ void InputDaemon::refresh()
     temp.start(100);
     q.exec();
 
+    // Events handed off before the refresh belong to the old SDL session.
+    if (eventHandoff != nullptr)
+        eventHandoff->clear();
+
     refreshJoysticks();
     QTimer::singleShot(100, eventWorker, SLOT(performWork()));
 
@@ -296,7 +351,11 @@ void InputDaemon::refresh()
 
 void InputDaemon::refreshJoystick(InputDevice *joystick)
 {
+    joystick->getInputMutex()->lock();
+    JoyButton::lockSharedState();
     joystick->reset();
+    JoyButton::unlockSharedState();
+    joystick->getInputMutex()->unlock();
 
     emit joystickRefreshed(joystick);
 }
@@ -308,6 +367,23 @@ void InputDaemon::quit()
 
     disconnect(eventWorker, &SDLEventReader::eventRaised, this, nullptr);
 
+    if (eventHandoff != nullptr)
+    {
+        disconnect(eventHandoff, &SDLEventHandoff::eventsAvailable, this, nullptr);
+        INFO() << eventHandoff->getLatencyReport();
+    }
+
+    if (LatencyTracer::isEnabled())
+        qInfo().noquote() << LatencyTracer::getReport();
+
+    if (eventRecorder != nullptr)
+    {
+        eventRecorder->close();
+        qInfo() << QString("Recorded %1 input events").arg(eventRecorder->getRecordedCount());
+    }
+
+    stopReplay();
+
     // Wait for SDL to finish. Let worker destructor close SDL.
     // Let InputDaemon destructor close thread instance.
     if (m_graphical)
@@ -360,6 +436,7 @@ void InputDaemon::refreshMapping(QString mapping, InputDevice *device)
                 if (SDL_IsGameController(i))
                 {
                     device->closeSDLDevice();
+                    deviceWorkers.remove(device);
                     getTrackjoysticksLocal().remove(joystickID);
                     m_joysticks->remove(joystickID);
 
@@ -390,6 +467,10 @@ void InputDaemon::refreshMapping(QString mapping, InputDevice *device)
                     joystickID = SDL_JoystickInstanceID(sdlStick);
                     m_joysticks->insert(joystickID, damncontroller);
                     trackcontrollers.insert(joystickID, damncontroller);
+
+                    if (m_thread_per_device)
+                        createDeviceWorker(damncontroller);
+
                     emit deviceUpdated(i, damncontroller);
                 }
             }
@@ -406,6 +487,8 @@ void InputDaemon::removeDevice(InputDevice *device)
     {
         SDL_JoystickID deviceID = device->getSDLJoystickID();
 
+        deleteBitArrayStatusInstances(device);
+        deviceWorkers.remove(device);
         m_joysticks->remove(deviceID);
         getTrackjoysticksLocal().remove(deviceID);
         trackcontrollers.remove(deviceID);
@@ -432,6 +515,91 @@ void InputDaemon::refreshIndexes()
     }
 }
 
+/**
+ * @brief Writes all controller input reaching firstInputPass to a file
+ *  until the daemon quits.
+ */
+void InputDaemon::startRecording(QString fileName)
+{
+    if (eventRecorder == nullptr)
+        eventRecorder = new SDLEventRecorder();
+
+    if (eventRecorder->open(fileName))
+        qInfo() << QString("Recording input events to %1").arg(fileName);
+    else
+        qWarning() << eventRecorder->getErrorString();
+}
+
+/**
+ * @brief Replaces live controller input with a recorded session. Recorded
+ *  devices are matched to connected devices by GUID, remaining ones fall
+ *  back to the first connected device.
+ */
+void InputDaemon::startReplay(QString fileName)
+{
+    stopReplay();
+
+    eventPlayer = new SDLEventPlayer();
+
+    if (!eventPlayer->open(fileName))
+    {
+        qWarning() << eventPlayer->getErrorString();
+        stopReplay();
+        return;
+    }
+
+    mapReplayDevices();
+
+    qInfo() << QString("Replaying %1 input events from %2").arg(eventPlayer->size()).arg(fileName);
+
+    eventPlayer->start();
+    replayTimer.start(qMax(1, GlobalVariables::JoyButton::gamepadRefreshRate));
+}
+
+void InputDaemon::mapReplayDevices()
+{
+    for (SDL_JoystickID recorded : eventPlayer->getRecordedDevices())
+    {
+        QString guid = eventPlayer->getRecordedGUIDString(recorded);
+        InputDevice *target = nullptr;
+
+        for (InputDevice *device : *m_joysticks)
+        {
+            if (device->getGUIDString() == guid)
+            {
+                target = device;
+                break;
+            }
+        }
+
+        if ((target == nullptr) && !m_joysticks->isEmpty())
+        {
+            target = m_joysticks->first();
+            qWarning() << QString("No controller with GUID %1 is connected. Replaying its events on %2")
+                              .arg(guid, target->getSDLName());
+        }
+
+        if (target != nullptr)
+            eventPlayer->setTargetDevice(recorded, target->getSDLJoystickID());
+        else
+            qWarning() << QString("No controller is connected. Events of %1 are skipped").arg(guid);
+    }
+}
+
+void InputDaemon::stopReplay()
+{
+    replayTimer.stop();
+
+    if (eventPlayer != nullptr)
+    {
+        if (eventPlayer->atEnd())
+            qInfo() << "Replay of input events finished";
+
+        delete eventPlayer;
+        eventPlayer = nullptr;
+    }
+}
+
 void InputDaemon::addInputDevice(int index, QMap<QString, int> &uniques, int &counterUniques, bool &duplicatedGamepad)
 {
 #ifdef USE_NEW_ADD
@@ -649,15 +817,17 @@ InputDeviceBitArrayStatus *
 InputDaemon::createOrGrabBitStatusEntry(QHash<InputDevice *, InputDeviceBitArrayStatus *> *statusHash, InputDevice *device,
                                         bool readCurrent)
 {
-    InputDeviceBitArrayStatus *bitArrayStatus = nullptr;
+    InputDeviceBitArrayStatus *bitArrayStatus = statusHash->value(device);
 
-    if (!statusHash->contains(device))
+    // Status objects live as long as their device and are reset in place
+    // the first time they are used during an input cycle.
+    if (bitArrayStatus == nullptr)
     {
         bitArrayStatus = new InputDeviceBitArrayStatus(device, readCurrent, this);
         statusHash->insert(device, bitArrayStatus);
-    } else
+    } else if (!bitArrayStatus->isInUse())
     {
-        bitArrayStatus = statusHash->value(device);
+        bitArrayStatus->reset(device, readCurrent);
     }
 
     return bitArrayStatus;
@@ -667,222 +837,312 @@ InputDaemon::createOrGrabBitStatusEntry(QHash<InputDevice *, InputDeviceBitArray
  * @brief Fetches events from SDL event queue, filters them and
  *  updates InputDeviceBitArrayStatus.
  */
-void InputDaemon::firstInputPass(QQueue<SDL_Event> *sdlEventQueue)
+void InputDaemon::firstInputPass(SDLEventRing *sdlEventQueue)
 {
-    SDL_Event event;
+    int queuedBefore = sdlEventQueue->size();
+    quint64 overflowBefore = sdlEventQueue->getOverflowCount();
+
+    if (eventHandoff != nullptr)
+        eventHandoff->drainInto(sdlEventQueue);
+    else if (sdlEventQueue->fetchFromSDL() < 0)
+        return;
 
-    while (SDL_PollEvent(&event) > 0)
+    if (sdlEventQueue->getOverflowCount() != overflowBefore)
+        DEBUG() << "SDL event ring is full. Remaining events are deferred to the next cycle. Overflow count: "
+                << sdlEventQueue->getOverflowCount();
+
+    if (eventPlayer != nullptr)
     {
-        if (Logger::isDebugEnabled())
-        {
-            const QMap<Uint32, QString> STRING_MAP = {
-                {SDL_JOYBUTTONDOWN, "SDL_JOYBUTTONDOWN"},
-                {SDL_JOYBUTTONUP, "SDL_JOYBUTTONUP"},
-                {SDL_JOYAXISMOTION, "SDL_JOYAXISMOTION"},
-                {SDL_JOYHATMOTION, "SDL_JOYHATMOTION"},
-                {SDL_CONTROLLERAXISMOTION, "SDL_CONTROLLERAXISMOTION"},
-                {SDL_CONTROLLERBUTTONDOWN, "SDL_CONTROLLERBUTTONDOWN"},
-                {SDL_CONTROLLERBUTTONUP, "SDL_CONTROLLERBUTTONUP"},
-                {SDL_JOYDEVICEREMOVED, "SDL_JOYDEVICEREMOVED"},
-                {SDL_JOYDEVICEADDED, "SDL_JOYDEVICEADDED"},
-                {SDL_CONTROLLERDEVICEREMOVED, "SDL_CONTROLLERDEVICEREMOVED"},
-                {SDL_CONTROLLERDEVICEADDED, "SDL_CONTROLLERDEVICEADDED"},
+        // Live controller input is replaced by the replayed session.
+        // Hotplug events still come from SDL.
+        int liveIndex = 0;
+        sdlEventQueue->retainIf([&liveIndex, queuedBefore](SDL_Event &event) {
+            return (liveIndex++ < queuedBefore) || !SDLEventRecorder::isInputEvent(event);
+        });
+
+        eventPlayer->takeDueEvents(sdlEventQueue);
+    }
+
+    int index = 0;
+    sdlEventQueue->retainIf([this, &index, queuedBefore](SDL_Event &event) {
+        // Events queued before this pass were already filtered.
+        if (index++ < queuedBefore)
+            return true;
+
+        if (eventRecorder != nullptr)
+            eventRecorder->record(event);
+
+        return filterInputEvent(event);
+    });
+}
+
+/**
+ * @brief Filters a single raw SDL event and updates
+ *  InputDeviceBitArrayStatus for it.
+ * @returns true if the event should be dispatched in secondInputPass.
+ */
+bool InputDaemon::filterInputEvent(const SDL_Event &event)
+{
+    bool keep = false;
+
+    // The device thread may be changing the input objects read here.
+    InputDevice *eventDevice = findEventDevice(event);
+
+    if (eventDevice != nullptr)
+        eventDevice->getInputMutex()->lock();
+
+    if (Logger::isDebugEnabled())
+    {
+        const QMap<Uint32, QString> STRING_MAP = {
+            {SDL_JOYBUTTONDOWN, "SDL_JOYBUTTONDOWN"},
+            {SDL_JOYBUTTONUP, "SDL_JOYBUTTONUP"},
+            {SDL_JOYAXISMOTION, "SDL_JOYAXISMOTION"},
+            {SDL_JOYHATMOTION, "SDL_JOYHATMOTION"},
+            {SDL_CONTROLLERAXISMOTION, "SDL_CONTROLLERAXISMOTION"},
+            {SDL_CONTROLLERBUTTONDOWN, "SDL_CONTROLLERBUTTONDOWN"},
+            {SDL_CONTROLLERBUTTONUP, "SDL_CONTROLLERBUTTONUP"},
+            {SDL_JOYDEVICEREMOVED, "SDL_JOYDEVICEREMOVED"},
+            {SDL_JOYDEVICEADDED, "SDL_JOYDEVICEADDED"},
+            {SDL_CONTROLLERDEVICEREMOVED, "SDL_CONTROLLERDEVICEREMOVED"},
+            {SDL_CONTROLLERDEVICEADDED, "SDL_CONTROLLERDEVICEADDED"},
 #if SDL_VERSION_ATLEAST(2, 0, 14)
-                {SDL_CONTROLLERSENSORUPDATE, "SDL_CONTROLLERSENSORUPDATE"},
-                {SDL_CONTROLLERTOUCHPADDOWN, "SDL_CONTROLLERTOUCHPADDOWN"},
-                {SDL_CONTROLLERTOUCHPADMOTION, "SDL_CONTROLLERTOUCHPADMOTION"},
-                {SDL_CONTROLLERTOUCHPADUP, "SDL_CONTROLLERTOUCHPADUP"}
+            {SDL_CONTROLLERSENSORUPDATE, "SDL_CONTROLLERSENSORUPDATE"},
+            {SDL_CONTROLLERTOUCHPADDOWN, "SDL_CONTROLLERTOUCHPADDOWN"},
+            {SDL_CONTROLLERTOUCHPADMOTION, "SDL_CONTROLLERTOUCHPADMOTION"},
+            {SDL_CONTROLLERTOUCHPADUP, "SDL_CONTROLLERTOUCHPADUP"}
 #endif
-            };
+        };
+
+        QString type;
+        if (STRING_MAP.contains(event.type))
+            type = STRING_MAP[event.type];
+        else
+            type = QString().number(event.type);
+        DEBUG() << "Processing event: " << type << " From joystick with instance id: " << (int)event.jbutton.which
+                << " Got button with id: " << (int)event.jbutton.button << " is one of the GameControllers: "
+                << (trackcontrollers.contains(event.jbutton.which) ? "true" : "false") << " is one of the joysticks:"
+                << (getTrackjoysticksLocal().contains(event.jbutton.which) ? "true" : "false");
+    }
+    switch (event.type)
+    {
+    case SDL_JOYBUTTONDOWN:
+    case SDL_JOYBUTTONUP: {
+        InputDevice *joy = getTrackjoysticksLocal().value(event.jbutton.which);
 
-            QString type;
-            if (STRING_MAP.contains(event.type))
-                type = STRING_MAP[event.type];
-            else
-                type = QString().number(event.type);
-            DEBUG() << "Processing event: " << type << " From joystick with instance id: " << (int)event.jbutton.which
-                    << " Got button with id: " << (int)event.jbutton.button << " is one of the GameControllers: "
-                    << (trackcontrollers.contains(event.jbutton.which) ? "true" : "false") << " is one of the joysticks:"
-                    << (getTrackjoysticksLocal().contains(event.jbutton.which) ? "true" : "false");
-        }
-        switch (event.type)
+        if (joy != nullptr)
         {
-        case SDL_JOYBUTTONDOWN:
-        case SDL_JOYBUTTONUP: {
-            InputDevice *joy = getTrackjoysticksLocal().value(event.jbutton.which);
+            SetJoystick *set = joy->getActiveSetJoystick();
+            JoyButton *button = set->getJoyButton(event.jbutton.button);
 
-            if (joy != nullptr)
-            {
-                SetJoystick *set = joy->getActiveSetJoystick();
-                JoyButton *button = set->getJoyButton(event.jbutton.button);
-
-                if (button != nullptr)
-                {
-                    InputDeviceBitArrayStatus *pending = createOrGrabBitStatusEntry(&pendingEventValues, joy);
-                    pending->changeButtonStatus(event.jbutton.button, event.type == SDL_JOYBUTTONDOWN ? true : false);
-                    sdlEventQueue->append(event);
-                }
-            } else
+            if (button != nullptr)
             {
-                sdlEventQueue->append(event);
+                InputDeviceBitArrayStatus *pending = createOrGrabBitStatusEntry(&pendingEventValues, joy);
+                pending->changeButtonStatus(event.jbutton.button, event.type == SDL_JOYBUTTONDOWN ? true : false);
+                keep = true;
             }
-
-            break;
+        } else
+        {
+            keep = true;
         }
-        case SDL_JOYAXISMOTION: {
-            InputDevice *joy = getTrackjoysticksLocal().value(event.jaxis.which);
 
-            if (joy != nullptr)
-            {
-                SetJoystick *set = joy->getActiveSetJoystick();
-                JoyAxis *axis = set->getJoyAxis(event.jaxis.axis);
+        break;
+    }
+    case SDL_JOYAXISMOTION: {
+        InputDevice *joy = getTrackjoysticksLocal().value(event.jaxis.which);
 
-                if (axis != nullptr)
-                {
-                    InputDeviceBitArrayStatus *temp = createOrGrabBitStatusEntry(&releaseEventsGenerated, joy, false);
-                    temp->changeAxesStatus(event.jaxis.axis, event.jaxis.axis == 0);
+        if (joy != nullptr)
+        {
+            SetJoystick *set = joy->getActiveSetJoystick();
+            JoyAxis *axis = set->getJoyAxis(event.jaxis.axis);
 
-                    InputDeviceBitArrayStatus *pending = createOrGrabBitStatusEntry(&pendingEventValues, joy);
-                    pending->changeAxesStatus(event.jaxis.axis, !axis->inDeadZone(event.jaxis.value));
-                    sdlEventQueue->append(event);
-                }
-            } else
+            if (axis != nullptr)
             {
-                sdlEventQueue->append(event);
-            }
+                InputDeviceBitArrayStatus *temp = createOrGrabBitStatusEntry(&releaseEventsGenerated, joy, false);
+                temp->changeAxesStatus(event.jaxis.axis, event.jaxis.axis == 0);
 
-            break;
+                InputDeviceBitArrayStatus *pending = createOrGrabBitStatusEntry(&pendingEventValues, joy);
+                pending->changeAxesStatus(event.jaxis.axis, !axis->inDeadZone(event.jaxis.value));
+                keep = true;
+            }
+        } else
+        {
+            keep = true;
         }
-        case SDL_JOYHATMOTION: {
-            InputDevice *joy = getTrackjoysticksLocal().value(event.jhat.which);
 
-            if (joy != nullptr)
-            {
-                SetJoystick *set = joy->getActiveSetJoystick();
-                JoyDPad *dpad = set->getJoyDPad(event.jhat.hat);
+        break;
+    }
+    case SDL_JOYHATMOTION: {
+        InputDevice *joy = getTrackjoysticksLocal().value(event.jhat.which);
 
-                if (dpad != nullptr)
-                {
-                    InputDeviceBitArrayStatus *pending = createOrGrabBitStatusEntry(&pendingEventValues, joy);
-                    pending->changeHatStatus(event.jhat.hat, (event.jhat.value != 0) ? true : false);
-                    sdlEventQueue->append(event);
-                }
-            } else
+        if (joy != nullptr)
+        {
+            SetJoystick *set = joy->getActiveSetJoystick();
+            JoyDPad *dpad = set->getJoyDPad(event.jhat.hat);
+
+            if (dpad != nullptr)
             {
-                sdlEventQueue->append(event);
+                InputDeviceBitArrayStatus *pending = createOrGrabBitStatusEntry(&pendingEventValues, joy);
+                pending->changeHatStatus(event.jhat.hat, (event.jhat.value != 0) ? true : false);
+                keep = true;
             }
-
-            break;
+        } else
+        {
+            keep = true;
         }
 
-        case SDL_CONTROLLERAXISMOTION: {
-            InputDevice *joy = trackcontrollers.value(event.caxis.which);
+        break;
+    }
 
-            if (joy != nullptr)
-            {
-                SetJoystick *set = joy->getActiveSetJoystick();
-                JoyAxis *axis = set->getJoyAxis(event.caxis.axis);
+    case SDL_CONTROLLERAXISMOTION: {
+        InputDevice *joy = trackcontrollers.value(event.caxis.which);
 
-                if (axis != nullptr)
-                {
-                    InputDeviceBitArrayStatus *temp = createOrGrabBitStatusEntry(&releaseEventsGenerated, joy, false);
+        if (joy != nullptr)
+        {
+            SetJoystick *set = joy->getActiveSetJoystick();
+            JoyAxis *axis = set->getJoyAxis(event.caxis.axis);
 
-                    if ((event.caxis.axis != SDL_CONTROLLER_AXIS_TRIGGERLEFT) &&
-                        (event.caxis.axis != SDL_CONTROLLER_AXIS_TRIGGERRIGHT))
-                    {
-                        temp->changeAxesStatus(event.caxis.axis, event.caxis.value == 0);
-                    } else
-                    {
-                        temp->changeAxesStatus(event.caxis.axis,
-                                               event.caxis.value ==
-                                                   GlobalVariables::InputDaemon::GAMECONTROLLERTRIGGERRELEASE);
-                    }
+            if (axis != nullptr)
+            {
+                InputDeviceBitArrayStatus *temp = createOrGrabBitStatusEntry(&releaseEventsGenerated, joy, false);
 
-                    InputDeviceBitArrayStatus *pending = createOrGrabBitStatusEntry(&pendingEventValues, joy);
-                    pending->changeAxesStatus(event.caxis.axis, !axis->inDeadZone(event.caxis.value));
-                    sdlEventQueue->append(event);
+                if ((event.caxis.axis != SDL_CONTROLLER_AXIS_TRIGGERLEFT) &&
+                    (event.caxis.axis != SDL_CONTROLLER_AXIS_TRIGGERRIGHT))
+                {
+                    temp->changeAxesStatus(event.caxis.axis, event.caxis.value == 0);
+                } else
+                {
+                    temp->changeAxesStatus(event.caxis.axis,
+                                           event.caxis.value ==
+                                               GlobalVariables::InputDaemon::GAMECONTROLLERTRIGGERRELEASE);
                 }
+
+                InputDeviceBitArrayStatus *pending = createOrGrabBitStatusEntry(&pendingEventValues, joy);
+                pending->changeAxesStatus(event.caxis.axis, !axis->inDeadZone(event.caxis.value));
+                keep = true;
             }
-            break;
         }
+        break;
+    }
 
 #if SDL_VERSION_ATLEAST(2, 0, 14)
-        case SDL_CONTROLLERSENSORUPDATE: {
-            InputDevice *joy = trackcontrollers.value(event.caxis.which);
+    case SDL_CONTROLLERSENSORUPDATE: {
+        InputDevice *joy = trackcontrollers.value(event.caxis.which);
 
-            if (joy != nullptr)
-            {
-                SetJoystick *set = joy->getActiveSetJoystick();
-                JoySensorType sensor_type;
-                if (event.csensor.sensor == SDL_SENSOR_ACCEL)
-                    sensor_type = ACCELEROMETER;
-                else if (event.csensor.sensor == SDL_SENSOR_GYRO)
-                    sensor_type = GYROSCOPE;
-                else
-                    qWarning() << "Unknown sensor type: " << event.csensor.sensor;
-
-                JoySensor *sensor = nullptr;
-                if (sensor_type == ACCELEROMETER || sensor_type == GYROSCOPE)
-                    sensor = set->getSensor(sensor_type);
-
-                if (sensor != nullptr)
-                {
-                    InputDeviceBitArrayStatus *temp = createOrGrabBitStatusEntry(&releaseEventsGenerated, joy, false);
-                    temp->changeSensorStatus(sensor_type, event.csensor.sensor == 0);
+        if (joy != nullptr)
+        {
+            SetJoystick *set = joy->getActiveSetJoystick();
+            JoySensorType sensor_type;
+            if (event.csensor.sensor == SDL_SENSOR_ACCEL)
+                sensor_type = ACCELEROMETER;
+            else if (event.csensor.sensor == SDL_SENSOR_GYRO)
+                sensor_type = GYROSCOPE;
+            else
+                qWarning() << "Unknown sensor type: " << event.csensor.sensor;
 
-                    InputDeviceBitArrayStatus *pending = createOrGrabBitStatusEntry(&pendingEventValues, joy);
-                    pending->changeSensorStatus(sensor_type, !sensor->inDeadZone(event.csensor.data));
-                    sdlEventQueue->append(event);
-                }
-            } else
+            JoySensor *sensor = nullptr;
+            if (sensor_type == ACCELEROMETER || sensor_type == GYROSCOPE)
+                sensor = set->getSensor(sensor_type);
+
+            if (sensor != nullptr)
             {
-                sdlEventQueue->append(event);
+                InputDeviceBitArrayStatus *temp = createOrGrabBitStatusEntry(&releaseEventsGenerated, joy, false);
+                temp->changeSensorStatus(sensor_type, event.csensor.sensor == 0);
+
+                InputDeviceBitArrayStatus *pending = createOrGrabBitStatusEntry(&pendingEventValues, joy);
+                pending->changeSensorStatus(sensor_type, !sensor->inDeadZone(event.csensor.data));
+                keep = true;
             }
-            break;
+        } else
+        {
+            keep = true;
         }
+        break;
+    }
 #endif
 
-        case SDL_CONTROLLERBUTTONDOWN:
-        case SDL_CONTROLLERBUTTONUP: {
-            InputDevice *joy = trackcontrollers.value(event.cbutton.which);
+    case SDL_CONTROLLERBUTTONDOWN:
+    case SDL_CONTROLLERBUTTONUP: {
+        InputDevice *joy = trackcontrollers.value(event.cbutton.which);
 
-            if (joy != nullptr)
-            {
-                SetJoystick *set = joy->getActiveSetJoystick();
-                JoyButton *button = set->getJoyButton(event.cbutton.button);
+        if (joy != nullptr)
+        {
+            SetJoystick *set = joy->getActiveSetJoystick();
+            JoyButton *button = set->getJoyButton(event.cbutton.button);
 
-                if (button != nullptr)
-                {
-                    InputDeviceBitArrayStatus *pending = createOrGrabBitStatusEntry(&pendingEventValues, joy);
-                    pending->changeButtonStatus(event.cbutton.button, event.type == SDL_CONTROLLERBUTTONDOWN ? true : false);
-                    sdlEventQueue->append(event);
-                }
+            if (button != nullptr)
+            {
+                InputDeviceBitArrayStatus *pending = createOrGrabBitStatusEntry(&pendingEventValues, joy);
+                pending->changeButtonStatus(event.cbutton.button, event.type == SDL_CONTROLLERBUTTONDOWN ? true : false);
+                keep = true;
             }
-
-            break;
-        }
-        case SDL_JOYDEVICEREMOVED:
-        case SDL_JOYDEVICEADDED:
-        case SDL_CONTROLLERDEVICEADDED:
-        case SDL_CONTROLLERDEVICEREMOVED: {
-            sdlEventQueue->append(event);
-            break;
-        }
-        case SDL_QUIT: {
-            sdlEventQueue->append(event);
-            break;
-        }
-        default: {
-            break;
-        }
         }
+
+        break;
+    }
+    case SDL_JOYDEVICEREMOVED:
+    case SDL_JOYDEVICEADDED:
+    case SDL_CONTROLLERDEVICEADDED:
+    case SDL_CONTROLLERDEVICEREMOVED: {
+        keep = true;
+        break;
+    }
+    case SDL_QUIT: {
+        keep = true;
+        break;
+    }
+    default: {
+        break;
+    }
+    }
+
+    if (eventDevice != nullptr)
+        eventDevice->getInputMutex()->unlock();
+
+    return keep;
+}
+
+/**
+ * @brief Finds the device whose input objects receive an event.
+ * @return nullptr for events of unknown devices and hotplug events
+ */
+InputDevice *InputDaemon::findEventDevice(const SDL_Event &event)
+{
+    InputDevice *device = nullptr;
+
+    switch (event.type)
+    {
+    case SDL_JOYBUTTONDOWN:
+    case SDL_JOYBUTTONUP:
+    case SDL_JOYAXISMOTION:
+    case SDL_JOYHATMOTION:
+        // Plain joystick events of game controllers update their raw values.
+        device = getTrackjoysticksLocal().value(event.jdevice.which);
+
+        if (device == nullptr)
+            device = trackcontrollers.value(event.jdevice.which);
+
+        break;
+
+    case SDL_CONTROLLERAXISMOTION:
+    case SDL_CONTROLLERBUTTONDOWN:
+    case SDL_CONTROLLERBUTTONUP:
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+    case SDL_CONTROLLERSENSORUPDATE:
+#endif
+        device = trackcontrollers.value(event.cdevice.which);
+        break;
+
+    default:
+        break;
     }
+
+    return device;
 }
 
 /**
  * @brief Postprocesses fetched raw events.
  */
-void InputDaemon::modifyUnplugEvents(QQueue<SDL_Event> *sdlEventQueue)
+void InputDaemon::modifyUnplugEvents(SDLEventRing *sdlEventQueue)
 {
     QHashIterator<InputDevice *, InputDeviceBitArrayStatus *> genIter(getReleaseEventsGeneratedLocal());
 
@@ -891,41 +1151,34 @@ void InputDaemon::modifyUnplugEvents(QQueue<SDL_Event> *sdlEventQueue)
         genIter.next();
         InputDevice *device = genIter.key();
         InputDeviceBitArrayStatus *generatedTemp = genIter.value();
+
+        if (!generatedTemp->isInUse())
+            continue;
+
+        QMutexLocker locker(device->getInputMutex());
+
         QBitArray tempBitArray = generatedTemp->generateFinalBitArray();
 
         int bitArraySize = tempBitArray.size();
 
-        qDebug() << "Raw array: " << tempBitArray << " array size: " << bitArraySize;
-
         if ((bitArraySize > 0) && (tempBitArray.count(true) == device->getNumberAxes()))
         {
-            if (getPendingEventValuesLocal().contains(device))
+            InputDeviceBitArrayStatus *pendingTemp = getPendingEventValuesLocal().value(device);
+
+            if ((pendingTemp != nullptr) && pendingTemp->isInUse())
             {
-                InputDeviceBitArrayStatus *pendingTemp = getPendingEventValuesLocal().value(device);
                 QBitArray pendingBitArray = pendingTemp->generateFinalBitArray();
                 QBitArray unplugBitArray = createUnplugEventBitArray(device);
                 int pendingBitArraySize = pendingBitArray.size();
 
                 if ((bitArraySize == pendingBitArraySize) && (pendingBitArray == unplugBitArray))
                 {
-                    QQueue<SDL_Event> tempQueue;
-
-                    while (!sdlEventQueue->isEmpty())
-                    {
-                        SDL_Event event = sdlEventQueue->dequeue();
-
+                    // Replace values of a possibly unplugged device with proper release values in place.
+                    sdlEventQueue->forEach([this, device](SDL_Event &event) {
                         switch (event.type)
                         {
-                        case SDL_JOYBUTTONDOWN:
-                        case SDL_JOYBUTTONUP: {
-                            tempQueue.enqueue(event);
-                            break;
-                        }
                         case SDL_JOYAXISMOTION: {
-                            if (event.jaxis.which != device->getSDLJoystickID())
-                            {
-                                tempQueue.enqueue(event);
-                            } else
+                            if (event.jaxis.which == device->getSDLJoystickID())
                             {
                                 InputDevice *joy = getTrackjoysticksLocal().value(event.jaxis.which);
 
@@ -940,21 +1193,12 @@ void InputDaemon::modifyUnplugEvents(QQueue<SDL_Event> *sdlEventQueue)
                                         }
                                     }
                                 }
-
-                                tempQueue.enqueue(event);
                             }
 
                             break;
                         }
-                        case SDL_JOYHATMOTION: {
-                            tempQueue.enqueue(event);
-                            break;
-                        }
                         case SDL_CONTROLLERAXISMOTION: {
-                            if (event.caxis.which != device->getSDLJoystickID())
-                            {
-                                tempQueue.enqueue(event);
-                            } else
+                            if (event.caxis.which == device->getSDLJoystickID())
                             {
                                 InputDevice *joy = trackcontrollers.value(event.caxis.which);
 
@@ -972,37 +1216,14 @@ void InputDaemon::modifyUnplugEvents(QQueue<SDL_Event> *sdlEventQueue)
                                         }
                                     }
                                 }
-
-                                tempQueue.enqueue(event);
                             }
 
                             break;
                         }
-#if SDL_VERSION_ATLEAST(2, 0, 14)
-                        case SDL_CONTROLLERSENSORUPDATE: {
-                            tempQueue.enqueue(event);
-                            break;
-                        }
-#endif
-                        case SDL_CONTROLLERBUTTONDOWN:
-                        case SDL_CONTROLLERBUTTONUP: {
-                            tempQueue.enqueue(event);
-                            break;
-                        }
-                        case SDL_JOYDEVICEREMOVED:
-                        case SDL_JOYDEVICEADDED:
-                        case SDL_CONTROLLERDEVICEREMOVED:
-                        case SDL_CONTROLLERDEVICEADDED: {
-                            tempQueue.enqueue(event);
+                        default:
                             break;
                         }
-                        default: {
-                            tempQueue.enqueue(event);
-                        }
-                        }
-                    }
-
-                    sdlEventQueue->swap(tempQueue);
+                    });
                 }
             }
         }
@@ -1027,166 +1248,48 @@ QBitArray InputDaemon::createUnplugEventBitArray(InputDevice *device)
 
 /**
  * @brief Dispatches postprocessed SDL events to the input objects like
- *  JoyAxis or JoyButton and activates them at the end.
+ *  JoyAxis or JoyButton and activates them at the end. Events of devices
+ *  with their own thread are posted to the InputDeviceWorker instead.
  */
-void InputDaemon::secondInputPass(QQueue<SDL_Event> *sdlEventQueue)
+void InputDaemon::secondInputPass(SDLEventRing *sdlEventQueue)
 {
     QMap<QString, int> uniques = QMap<QString, int>();
     int counterUniques = 1;
     bool duplicatedGamepad = false;
 
-    QHash<SDL_JoystickID, InputDevice *> activeDevices;
-
-    while (!sdlEventQueue->isEmpty())
-    {
-        SDL_Event event = sdlEventQueue->dequeue();
-
-        switch (event.type)
-        {
-        case SDL_JOYBUTTONDOWN:
-        case SDL_JOYBUTTONUP: {
-            InputDevice *joy = getTrackjoysticksLocal().value(event.jbutton.which);
-
-            if (joy != nullptr)
-            {
-                SetJoystick *set = joy->getActiveSetJoystick();
-                JoyButton *button = set->getJoyButton(event.jbutton.button);
-
-                if (button != nullptr)
-                {
-                    button->queuePendingEvent(event.type == SDL_JOYBUTTONDOWN ? true : false);
-
-                    if (!activeDevices.contains(event.jbutton.which))
-                        activeDevices.insert(event.jbutton.which, joy);
-                }
-            } else if (trackcontrollers.contains(event.jbutton.which))
-            {
-                GameController *gamepad = trackcontrollers.value(event.jbutton.which);
-                gamepad->rawButtonEvent(event.jbutton.button, event.type == SDL_JOYBUTTONDOWN ? true : false);
-            }
-
-            break;
-        }
-
-        case SDL_JOYAXISMOTION: {
-            InputDevice *joy = getTrackjoysticksLocal().value(event.jaxis.which);
-
-            if (joy != nullptr)
-            {
-                SetJoystick *set = joy->getActiveSetJoystick();
-                JoyAxis *axis = set->getJoyAxis(event.jaxis.axis);
-
-                if (axis != nullptr)
-                {
-                    axis->queuePendingEvent(event.jaxis.value);
-
-                    if (!activeDevices.contains(event.jaxis.which))
-                        activeDevices.insert(event.jaxis.which, joy);
-                }
-
-                joy->rawAxisEvent(event.jaxis.which, event.jaxis.value);
-            } else if (trackcontrollers.contains(event.jaxis.which))
-            {
-                GameController *gamepad = trackcontrollers.value(event.jaxis.which);
-                gamepad->rawAxisEvent(event.jaxis.axis, event.jaxis.value);
-            }
-
-            break;
-        }
-
-        case SDL_JOYHATMOTION: {
-            InputDevice *joy = getTrackjoysticksLocal().value(event.jhat.which);
-
-            if (joy != nullptr)
-            {
-                SetJoystick *set = joy->getActiveSetJoystick();
-                JoyDPad *dpad = set->getJoyDPad(event.jhat.hat);
-
-                if (dpad != nullptr)
-                {
-                    dpad->joyEvent(event.jhat.value);
-
-                    if (!activeDevices.contains(event.jhat.which))
-                        activeDevices.insert(event.jhat.which, joy);
-                }
-            } else if (trackcontrollers.contains(event.jhat.which))
-            {
-                GameController *gamepad = trackcontrollers.value(event.jaxis.which);
-                gamepad->rawDPadEvent(event.jhat.hat, event.jhat.value);
-            }
-
-            break;
-        }
-
-        case SDL_CONTROLLERAXISMOTION: {
-            InputDevice *joy = trackcontrollers.value(event.caxis.which);
-
-            if (joy != nullptr)
-            {
-                SetJoystick *set = joy->getActiveSetJoystick();
-                JoyAxis *axis = set->getJoyAxis(event.caxis.axis);
+    // Output generated by the whole pass is written as one frame per device.
+    BaseEventHandler *eventHandler = EventHandlerFactory::getInstance()->handler();
+    eventHandler->beginBatch();
 
-                if (axis != nullptr)
-                {
-                    axis->queuePendingEvent(event.caxis.value);
-
-                    if (!activeDevices.contains(event.caxis.which))
-                        activeDevices.insert(event.caxis.which, joy);
-                }
-            }
+    SDL_Event event;
 
-            break;
-        }
+    while (sdlEventQueue->dequeue(event))
+    {
+        if (LatencyTracer::isEnabled())
+            LatencyTracer::beginEvent(event.common.timestamp);
 
-#if SDL_VERSION_ATLEAST(2, 0, 14)
-        case SDL_CONTROLLERSENSORUPDATE: {
-            InputDevice *joy = trackcontrollers.value(event.csensor.which);
+        InputDevice *eventDevice = findEventDevice(event);
+        InputDeviceWorker *worker = deviceWorkers.value(eventDevice);
 
-            if (joy != nullptr)
-            {
-                SetJoystick *set = joy->getActiveSetJoystick();
-                JoySensor *sensor = nullptr;
-                if (event.csensor.sensor == SDL_SENSOR_ACCEL)
-                    sensor = set->getSensor(ACCELEROMETER);
-                else if (event.csensor.sensor == SDL_SENSOR_GYRO)
-                    sensor = set->getSensor(GYROSCOPE);
-                else
-                    Q_ASSERT(false);
-
-                if (sensor != nullptr)
-                {
-                    sensor->queuePendingEvent(event.csensor.data);
+        if (worker != nullptr)
+        {
+            worker->post(event);
+        } else if (eventDevice != nullptr)
+        {
+            // Every event is activated right away, so no other device can
+            // have queued events and only this one has to be scanned.
+            PadderCommon::inputDaemonLock.lockForRead();
+            eventDevice->getInputMutex()->lock();
 
-                    if (!activeDevices.contains(event.csensor.which))
-                        activeDevices.insert(event.csensor.which, joy);
-                }
-            }
+            if (eventDevice->dispatchEvent(event))
+                eventDevice->activatePossiblePendingEvents();
 
-            break;
-        }
-#endif
-
-        case SDL_CONTROLLERBUTTONDOWN:
-        case SDL_CONTROLLERBUTTONUP: {
-            InputDevice *joy = trackcontrollers.value(event.cbutton.which);
-
-            if (joy != nullptr)
-            {
-                SetJoystick *set = joy->getActiveSetJoystick();
-                JoyButton *button = set->getJoyButton(event.cbutton.button);
-
-                if (button != nullptr)
-                {
-                    button->queuePendingEvent(event.type == SDL_CONTROLLERBUTTONDOWN ? true : false);
-
-                    if (!activeDevices.contains(event.cbutton.which))
-                        activeDevices.insert(event.cbutton.which, joy);
-                }
-            }
-
-            break;
+            eventDevice->getInputMutex()->unlock();
+            PadderCommon::inputDaemonLock.unlock();
         }
 
+        switch (event.type)
+        {
         case SDL_JOYDEVICEREMOVED:
         case SDL_CONTROLLERDEVICEREMOVED: {
             InputDevice *device = m_joysticks->value(event.jdevice.which);
@@ -1218,58 +1321,45 @@ void InputDaemon::secondInputPass(QQueue<SDL_Event> *sdlEventQueue)
             break;
         }
 
-        // Active possible queued events.
-        QHashIterator<SDL_JoystickID, InputDevice *> activeDevIter(activeDevices);
+        JoyButton::lockSharedState();
+        bool invokeMouseEvents = JoyButton::shouldInvokeMouseEvents(
+            JoyButton::getPendingMouseButtons(), JoyButton::getStaticMouseEventTimer(), JoyButton::getTestOldMouseTime());
+        JoyButton::unlockSharedState();
 
-        while (activeDevIter.hasNext())
-        {
-            InputDevice *tempDevice = activeDevIter.next().value();
-            tempDevice->activatePossibleControlStickEvents();
-            tempDevice->activatePossibleAxisEvents();
-            tempDevice->activatePossibleSensorEvents();
-            tempDevice->activatePossibleDPadEvents();
-            tempDevice->activatePossibleVDPadEvents();
-            tempDevice->activatePossibleButtonEvents();
-        }
-
-        if (JoyButton::shouldInvokeMouseEvents(JoyButton::getPendingMouseButtons(), JoyButton::getStaticMouseEventTimer(),
-                                               JoyButton::getTestOldMouseTime()))
+        if (invokeMouseEvents)
             JoyButton::invokeMouseEvents(
                 JoyButton::getMouseHelper()); // Do not wait for next event loop run. Execute immediately.
-    }
-}
 
-void InputDaemon::clearBitArrayStatusInstances()
-{
-    QHashIterator<InputDevice *, InputDeviceBitArrayStatus *> genIter(releaseEventsGenerated);
-
-    while (genIter.hasNext())
-    {
-        InputDeviceBitArrayStatus *temp = genIter.next().value();
+        // Output of a traced event has to be written before its trace ends.
+        if (LatencyTracer::isEnabled())
+            eventHandler->flushBatch();
 
-        if (temp != nullptr)
-        {
-            temp->deleteLater();
-            temp = nullptr;
-        }
+        LatencyTracer::endEvent();
     }
 
-    getReleaseEventsGeneratedLocal().clear();
-
-    QHashIterator<InputDevice *, InputDeviceBitArrayStatus *> pendIter(pendingEventValues);
+    eventHandler->endBatch();
+}
 
-    while (pendIter.hasNext())
-    {
-        InputDeviceBitArrayStatus *temp = pendIter.next().value();
+/**
+ * @brief Marks the status objects of the finished input cycle as unused.
+ *  They are kept and reset in place by the next cycle.
+ */
+void InputDaemon::clearBitArrayStatusInstances()
+{
+    for (InputDeviceBitArrayStatus *temp : qAsConst(releaseEventsGenerated))
+        temp->release();
 
-        if (temp != nullptr)
-        {
-            temp->deleteLater();
-            temp = nullptr;
-        }
-    }
+    for (InputDeviceBitArrayStatus *temp : qAsConst(pendingEventValues))
+        temp->release();
+}
 
-    getPendingEventValuesLocal().clear();
+/**
+ * @brief Deletes the status objects of a device which is going away.
+ */
+void InputDaemon::deleteBitArrayStatusInstances(InputDevice *device)
+{
+    delete releaseEventsGenerated.take(device);
+    delete pendingEventValues.take(device);
 }
 
 void InputDaemon::resetActiveButtonMouseDistances()
@@ -1279,6 +1369,14 @@ void InputDaemon::resetActiveButtonMouseDistances()
     JoyButton::resetActiveButtonMouseDistances(JoyButton::getMouseHelper());
 }
 
+/**
+ * @brief Moves a new device to a thread of its own.
+ */
+void InputDaemon::createDeviceWorker(InputDevice *device)
+{
+    deviceWorkers.insert(device, new InputDeviceWorker(device, this));
+}
+
 void InputDaemon::updatePollResetRate(int tempPollRate)
 {
     Q_UNUSED(tempPollRate);
@@ -1322,3 +1420,9 @@ QHash<InputDevice *, InputDeviceBitArrayStatus *> &InputDaemon::getReleaseEvents
 }
 
 QHash<InputDevice *, InputDeviceBitArrayStatus *> &InputDaemon::getPendingEventValuesLocal() { return pendingEventValues; }
+
+/**
+ * @brief Number of input cycles which could not fetch all pending SDL
+ *  events at once because the event ring was full.
+ */
+quint64 InputDaemon::getEventQueueOverflowCount() const { return sdlEventQueue.getOverflowCount(); }
@@ -20,15 +20,20 @@
 #define INPUTDAEMONTHREAD_H
 
 #include "gamecontroller/gamecontroller.h"
+#include "sdleventring.h"
 //#include "fakeclasses/xbox360wireless.h"
 #include <SDL2/SDL_events.h>
 
 class InputDevice;
 class AntiMicroSettings;
 class InputDeviceBitArrayStatus;
+class InputDeviceWorker;
 class Joystick;
 class GameController;
 class SDLEventReader;
+class SDLEventHandoff;
+class SDLEventRecorder;
+class SDLEventPlayer;
 class QThread;
 
 /**
@@ -45,6 +50,8 @@ class InputDaemon : public QObject
                          QObject *parent = 0);
     ~InputDaemon();
 
+    quint64 getEventQueueOverflowCount() const;
+
   protected:
     InputDeviceBitArrayStatus *createOrGrabBitStatusEntry(QHash<InputDevice *, InputDeviceBitArrayStatus *> *statusHash,
                                                           InputDevice *device, bool readCurrent = true);
@@ -52,13 +59,18 @@ class InputDaemon : public QObject
     QString getJoyInfo(SDL_JoystickGUID sdlvalue);
     QString getJoyInfo(Uint16 sdlvalue);
 
-    void firstInputPass(QQueue<SDL_Event> *sdlEventQueue);
-    void secondInputPass(QQueue<SDL_Event> *sdlEventQueue);
-    void modifyUnplugEvents(QQueue<SDL_Event> *sdlEventQueue);
+    void firstInputPass(SDLEventRing *sdlEventQueue);
+    InputDevice *findEventDevice(const SDL_Event &event);
+    bool filterInputEvent(const SDL_Event &event);
+    void secondInputPass(SDLEventRing *sdlEventQueue);
+    void modifyUnplugEvents(SDLEventRing *sdlEventQueue);
+    void mapReplayDevices();
+    void stopReplay();
     QBitArray createUnplugEventBitArray(InputDevice *device);
     Joystick *openJoystickDevice(int index);
 
     void clearBitArrayStatusInstances();
+    void deleteBitArrayStatusInstances(InputDevice *device);
     void convertMappingsToUnique(QSettings *sett, QString guidString, QString uniqueIdString);
 
   signals:
@@ -82,11 +94,14 @@ class InputDaemon : public QObject
     void removeDevice(InputDevice *device);
     void addInputDevice(int index, QMap<QString, int> &uniques, int &counterUniques, bool &duplicatedGamepad);
     void refreshIndexes();
+    void startRecording(QString fileName);
+    void startReplay(QString fileName);
 
   private slots:
     void stop();
     void resetActiveButtonMouseDistances();
     void updatePollResetRate(int tempPollRate);
+    void createDeviceWorker(InputDevice *device);
 
   private:
     QHash<SDL_JoystickID, Joystick *> &getTrackjoysticksLocal();
@@ -99,14 +114,21 @@ class InputDaemon : public QObject
 
     QHash<InputDevice *, InputDeviceBitArrayStatus *> releaseEventsGenerated;
     QHash<InputDevice *, InputDeviceBitArrayStatus *> pendingEventValues;
+    QHash<InputDevice *, InputDeviceWorker *> deviceWorkers;
 
     bool stopped;
     bool m_graphical;
+    bool m_thread_per_device;
 
     SDLEventReader *eventWorker;
+    SDLEventHandoff *eventHandoff;
     QThread *sdlWorkerThread;
     AntiMicroSettings *m_settings;
     QTimer pollResetTimer;
+    QTimer replayTimer;
+    SDLEventRing sdlEventQueue;
+    SDLEventRecorder *eventRecorder;
+    SDLEventPlayer *eventPlayer;
     // SDL_Joystick* xbox360;
 };
 
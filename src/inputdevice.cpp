@@ -32,6 +32,7 @@
 #include <typeinfo>
 
 #include <QDebug>
+#include <QEvent>
 #include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 
@@ -51,9 +52,23 @@ InputDevice::InputDevice(SDL_Joystick *joystick, int deviceIndex, AntiMicroSetti
     keyRepeatRate = 0;
     rawAxisDeadZone = GlobalVariables::InputDevice::RAISEDDEADZONE;
     m_settings = settings;
+
+    QMutexLocker locker(&registryMutex);
+    registeredDevices.append(this);
+    m_registered = true;
+}
+
+InputDevice::~InputDevice()
+{
+    if (m_registered)
+    {
+        QMutexLocker locker(&registryMutex);
+        registeredDevices.removeOne(this);
+    }
 }
 
-InputDevice::~InputDevice() {}
+QMutex InputDevice::registryMutex;
+QList<InputDevice *> InputDevice::registeredDevices;
 
 int InputDevice::getJoyNumber() { return joyNumber; }
 
@@ -1416,10 +1431,118 @@ bool InputDevice::isKnownController()
     return result;
 }
 
+/**
+ * @brief Passes a joystick event to the matching element of the active set.
+ * @return true if the element has a pending event which has to be activated
+ *  with activatePossiblePendingEvents()
+ */
+bool InputDevice::dispatchEvent(const SDL_Event &event)
+{
+    SetJoystick *set = getActiveSetJoystick();
+    bool queued = false;
+
+    switch (event.type)
+    {
+    case SDL_JOYBUTTONDOWN:
+    case SDL_JOYBUTTONUP: {
+        JoyButton *button = set->getJoyButton(event.jbutton.button);
+
+        if (button != nullptr)
+        {
+            button->queuePendingEvent(event.type == SDL_JOYBUTTONDOWN);
+            queued = true;
+        }
+
+        break;
+    }
+
+    case SDL_JOYAXISMOTION: {
+        JoyAxis *axis = set->getJoyAxis(event.jaxis.axis);
+
+        if (axis != nullptr)
+        {
+            axis->queuePendingEvent(event.jaxis.value);
+            queued = true;
+        }
+
+        rawAxisEvent(event.jaxis.which, event.jaxis.value);
+        break;
+    }
+
+    case SDL_JOYHATMOTION: {
+        JoyDPad *dpad = set->getJoyDPad(event.jhat.hat);
+
+        if (dpad != nullptr)
+        {
+            dpad->joyEvent(event.jhat.value);
+            queued = true;
+        }
+
+        break;
+    }
+
+    default:
+        break;
+    }
+
+    return queued;
+}
+
+/**
+ * @brief Lock held while the input objects of this device process events.
+ *  Other threads take it before they read the state of the device.
+ */
+QMutex *InputDevice::getInputMutex() { return &m_input_mutex; }
+
+/**
+ * @brief Locks the input mutex of every device. Used by the mouse helper
+ *  which reads the pending mouse buttons of all devices at once. Devices
+ *  are not added or deleted until unlockAllDevices() is called.
+ */
+void InputDevice::lockAllDevices()
+{
+    registryMutex.lock();
+
+    for (InputDevice *device : qAsConst(registeredDevices))
+        device->m_input_mutex.lock();
+}
+
+void InputDevice::unlockAllDevices()
+{
+    for (InputDevice *device : qAsConst(registeredDevices))
+        device->m_input_mutex.unlock();
+
+    registryMutex.unlock();
+}
+
+/**
+ * @brief Deletes the device with the other devices and the shared button
+ *  state locked. Input objects of a device running on its own thread may be
+ *  pending mouse buttons that the mouse helper and other devices still see.
+ */
+bool InputDevice::event(QEvent *event)
+{
+    if (event->type() != QEvent::DeferredDelete)
+        return QObject::event(event);
+
+    registryMutex.lock();
+    registeredDevices.removeOne(this);
+    m_registered = false;
+    JoyButton::lockSharedState();
+
+    bool result = QObject::event(event); // Deletes this
+
+    JoyButton::unlockSharedState();
+    registryMutex.unlock();
+
+    return result;
+}
+
 void InputDevice::activatePossiblePendingEvents()
 {
     activatePossibleControlStickEvents();
     activatePossibleAxisEvents();
+    activatePossibleSensorEvents();
     activatePossibleDPadEvents();
     activatePossibleVDPadEvents();
     activatePossibleButtonEvents();
@@ -24,8 +24,11 @@
 #include "joysensortype.h"
 #include "setjoystick.h"
 
+#include <SDL2/SDL_events.h>
 #include <SDL2/SDL_joystick.h>
 
+#include <QMutex>
+
 class AntiMicroSettings;
 class SetJoystick;
 class QXmlStreamReader;
@@ -140,6 +143,11 @@ class InputDevice : public QObject
     void sendLoadProfileRequest(QString location);
     AntiMicroSettings *getSettings();
 
+    virtual bool dispatchEvent(const SDL_Event &event);
+    QMutex *getInputMutex();
+    static void lockAllDevices();
+    static void unlockAllDevices();
+
     void activatePossiblePendingEvents();
     void activatePossibleControlStickEvents(); // InputDeviceStick class
     void activatePossibleAxisEvents();         // InputDeviceAxis class
@@ -172,6 +180,7 @@ class InputDevice : public QObject
     void applyGyroscopeCalibration(double offsetX, double offsetY, double offsetZ);
 
   protected:
+    virtual bool event(QEvent *event) override;
     void enableSetConnections(SetJoystick *setstick);
 
     QHash<int, JoyAxis::ThrottleTypes> &getCali();
@@ -285,6 +294,12 @@ class InputDevice : public QObject
     QList<bool> buttonstates;
     QList<int> axesstates;
     QList<int> dpadstates;
+
+    QMutex m_input_mutex;
+    bool m_registered;
+
+    static QMutex registryMutex;
+    static QList<InputDevice *> registeredDevices;
 };
 
 Q_DECLARE_METATYPE(InputDevice *)
@@ -28,41 +28,57 @@
 
 InputDeviceBitArrayStatus::InputDeviceBitArrayStatus(InputDevice *device, bool readCurrent, QObject *parent)
     : QObject(parent)
+    , m_in_use(false)
 {
+    reset(device, readCurrent);
+}
+
+/**
+ * @brief Reinitializes the status for a new input cycle. The storage is
+ *  reused as long as the layout of the device does not change.
+ * @param Device the status belongs to
+ * @param true to start with the current state of the device, false to
+ *  start with everything released
+ */
+void InputDeviceBitArrayStatus::reset(InputDevice *device, bool readCurrent)
+{
+    SetJoystick *currentSet = device->getActiveSetJoystick();
+
+    while (axesStatus.size() > device->getNumberRawAxes())
+        axesStatus.removeLast();
+
     for (int i = 0; i < device->getNumberRawAxes(); i++)
     {
-        SetJoystick *currentSet = device->getActiveSetJoystick();
         JoyAxis *axis = currentSet->getJoyAxis(i);
+        bool value = (axis != nullptr) && readCurrent && !axis->inDeadZone(axis->getCurrentRawValue());
 
-        if ((axis != nullptr) && readCurrent)
-        {
-            axesStatus.append(!axis->inDeadZone(axis->getCurrentRawValue()) ? true : false);
-        } else
-        {
-            axesStatus.append(false);
-        }
+        if (i < axesStatus.size())
+            axesStatus.replace(i, value);
+        else
+            axesStatus.append(value);
     }
 
+    while (hatButtonStatus.size() > device->getNumberRawHats())
+        hatButtonStatus.removeLast();
+
     for (int i = 0; i < device->getNumberRawHats(); i++)
     {
-        SetJoystick *currentSet = device->getActiveSetJoystick();
         JoyDPad *dpad = currentSet->getJoyDPad(i);
+        bool value = (dpad != nullptr) && readCurrent && (dpad->getCurrentDirection() != JoyDPadButton::DpadCentered);
 
-        if ((dpad != nullptr) && readCurrent)
-        {
-            hatButtonStatus.append(dpad->getCurrentDirection() != JoyDPadButton::DpadCentered ? true : false);
-        } else
-        {
-            hatButtonStatus.append(false);
-        }
+        if (i < hatButtonStatus.size())
+            hatButtonStatus.replace(i, value);
+        else
+            hatButtonStatus.append(value);
     }
 
-    getButtonStatusLocal().resize(device->getNumberRawButtons());
-    getButtonStatusLocal().fill(0);
+    if (getButtonStatusLocal().size() != device->getNumberRawButtons())
+        getButtonStatusLocal().resize(device->getNumberRawButtons());
+
+    getButtonStatusLocal().fill(false);
 
     for (int i = 0; i < device->getNumberRawButtons(); i++)
     {
-        SetJoystick *currentSet = device->getActiveSetJoystick();
         JoyButton *button = currentSet->getJoyButton(i);
 
         if ((button != nullptr) && readCurrent)
@@ -71,10 +87,24 @@ InputDeviceBitArrayStatus::InputDeviceBitArrayStatus(InputDevice *device, bool r
         }
     }
 
-    m_sensor_status.resize(SENSOR_COUNT);
-    m_sensor_status.fill(0);
+    if (m_sensor_status.size() != SENSOR_COUNT)
+        m_sensor_status.resize(SENSOR_COUNT);
+
+    m_sensor_status.fill(false);
+    m_in_use = true;
 }
 
+/**
+ * @brief Checks if the status was reset during the current input cycle
+ */
+bool InputDeviceBitArrayStatus::isInUse() const { return m_in_use; }
+
+/**
+ * @brief Marks the status as unused at the end of an input cycle.
+ *  It is kept for the next cycle instead of being deleted.
+ */
+void InputDeviceBitArrayStatus::release() { m_in_use = false; }
+
 void InputDeviceBitArrayStatus::changeAxesStatus(int axisIndex, bool value)
 {
     if ((axisIndex >= 0) && (axisIndex <= axesStatus.size()))
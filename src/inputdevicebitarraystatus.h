@@ -32,6 +32,10 @@ class InputDeviceBitArrayStatus : public QObject
   public:
     explicit InputDeviceBitArrayStatus(InputDevice *device, bool readCurrent, QObject *parent);
 
+    void reset(InputDevice *device, bool readCurrent);
+    bool isInUse() const;
+    void release();
+
     void changeAxesStatus(int axisIndex, bool value);
     void changeButtonStatus(int buttonIndex, bool value);
     void changeHatStatus(int hatIndex, bool value);
@@ -47,6 +51,7 @@ class InputDeviceBitArrayStatus : public QObject
     QList<bool> hatButtonStatus;
     QBitArray buttonStatus;
     QBitArray m_sensor_status;
+    bool m_in_use;
 };
 
 #endif // INPUTDEVICESTATUSEVENT_H
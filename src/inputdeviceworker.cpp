@@ -0,0 +1,144 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "inputdeviceworker.h"
+
+#include "common.h"
+#include "eventhandlerfactory.h"
+#include "inputdevice.h"
+#include "joybuttontypes/joybutton.h"
+
+#include <QThread>
+
+InputDeviceWorker::InputDeviceWorker(InputDevice *device, QObject *parent)
+    : QObject(parent)
+    , m_device(device)
+{
+    m_thread = new QThread;
+    m_thread->setObjectName(QString("inputDeviceThread%1").arg(device->getRealJoyNumber()));
+
+    // Objects cannot be moved away from their parent.
+    device->setParent(nullptr);
+    device->moveToThread(m_thread);
+
+    // Timers of the device fire in its thread and need the same locks as
+    // the events dispatched there.
+    connect(
+        m_thread, &QThread::started, this, [this] { TimerWheel::getInstance()->setGuard(this); }, Qt::DirectConnection);
+
+    connect(
+        device, &QObject::destroyed, m_thread,
+        [this] {
+            TimerWheel::getInstance()->setGuard(nullptr);
+            m_thread->quit();
+        },
+        Qt::DirectConnection);
+    connect(device, &QObject::destroyed, this, &InputDeviceWorker::deleteLater);
+
+    m_thread->start(QThread::HighPriority);
+}
+
+InputDeviceWorker::~InputDeviceWorker()
+{
+    // The device is deleted by the thread before it finishes.
+    if (!m_device.isNull())
+        m_device->deleteLater();
+
+    m_thread->quit();
+    m_thread->wait();
+    delete m_thread;
+}
+
+/**
+ * @brief Queues an event of the device. Called from the InputDaemon thread.
+ *  The device thread is woken up once for all events posted until it runs.
+ */
+void InputDeviceWorker::post(const SDL_Event &event)
+{
+    m_queue_mutex.lock();
+    bool wakeup = m_pending.isEmpty();
+    m_pending.append(event);
+    m_queue_mutex.unlock();
+
+    if (wakeup)
+        QMetaObject::invokeMethod(
+            m_device, [this] { processEvents(); }, Qt::QueuedConnection);
+}
+
+void InputDeviceWorker::processEvents()
+{
+    m_queue_mutex.lock();
+    m_processing.swap(m_pending);
+    m_queue_mutex.unlock();
+
+    // Output of all events is written as one frame like in the input thread.
+    BaseEventHandler *eventHandler = EventHandlerFactory::getInstance()->handler();
+    eventHandler->beginBatch();
+
+    PadderCommon::inputDaemonLock.lockForRead();
+    m_device->getInputMutex()->lock();
+
+    for (const SDL_Event &event : qAsConst(m_processing))
+    {
+        if (m_device->dispatchEvent(event))
+            m_device->activatePossiblePendingEvents();
+    }
+
+    m_device->getInputMutex()->unlock();
+    PadderCommon::inputDaemonLock.unlock();
+
+    eventHandler->endBatch();
+
+    m_processing.clear();
+
+    // Mouse events of all devices are generated by the mouse helper. Its
+    // timer cannot be checked from this thread.
+    JoyButton::lockSharedState();
+    bool mouseButtonsPending = !JoyButton::getPendingMouseButtons()->isEmpty();
+    JoyButton::unlockSharedState();
+
+    if (mouseButtonsPending)
+        QMetaObject::invokeMethod(
+            JoyButton::getMouseHelper(),
+            [] {
+                JoyButton::lockSharedState();
+                bool invoke = JoyButton::shouldInvokeMouseEvents(JoyButton::getPendingMouseButtons(),
+                                                                 JoyButton::getStaticMouseEventTimer(),
+                                                                 JoyButton::getTestOldMouseTime());
+                JoyButton::unlockSharedState();
+
+                if (invoke)
+                    JoyButton::invokeMouseEvents(JoyButton::getMouseHelper());
+            },
+            Qt::QueuedConnection);
+}
+
+/**
+ * @brief Called by the TimerWheel of the device thread before timers of
+ *  the input objects fire.
+ */
+void InputDeviceWorker::lockTimers()
+{
+    m_device->getInputMutex()->lock();
+    JoyButton::lockSharedState();
+}
+
+void InputDeviceWorker::unlockTimers()
+{
+    JoyButton::unlockSharedState();
+    m_device->getInputMutex()->unlock();
+}
@@ -0,0 +1,65 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INPUTDEVICEWORKER_H
+#define INPUTDEVICEWORKER_H
+
+#include "timerwheel.h"
+
+#include <SDL2/SDL_events.h>
+
+#include <QMutex>
+#include <QObject>
+#include <QPointer>
+#include <QVector>
+
+class InputDevice;
+class QThread;
+
+/**
+ * @brief Runs the input objects of one device in a thread of their own.
+ *  InputDaemon filters events as before and posts the events of the device
+ *  here. They are dispatched and activated in the device thread with the
+ *  input mutex of the device held, so devices do not wait for each other.
+ *  State shared by all buttons is guarded by JoyButton::lockSharedState().
+ *  The worker lives in the InputDaemon thread, the device is moved to the
+ *  worker thread and deleted there.
+ */
+class InputDeviceWorker : public QObject, public TimerWheelGuard
+{
+    Q_OBJECT
+
+  public:
+    explicit InputDeviceWorker(InputDevice *device, QObject *parent = nullptr);
+    ~InputDeviceWorker();
+
+    void post(const SDL_Event &event);
+
+    void lockTimers() override;
+    void unlockTimers() override;
+
+  private:
+    void processEvents();
+
+    QPointer<InputDevice> m_device;
+    QThread *m_thread;
+    QMutex m_queue_mutex;
+    QVector<SDL_Event> m_pending;
+    QVector<SDL_Event> m_processing;
+};
+
+#endif // INPUTDEVICEWORKER_H
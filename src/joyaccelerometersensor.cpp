@@ -26,6 +26,7 @@
 const double JoyAccelerometerSensor::SHOCK_DETECT_THRESHOLD = 20.0;
 const double JoyAccelerometerSensor::SHOCK_SUPPRESS_FACTOR = 0.5;
 const double JoyAccelerometerSensor::SHOCK_TAU = 0.05;
+const double JoyAccelerometerSensor::GRAVITY_TAU = 0.25;
 
 JoyAccelerometerSensor::JoyAccelerometerSensor(double rate, int originset, SetJoystick *parent_set, QObject *parent)
     : JoySensor(ACCELEROMETER, originset, parent_set, parent)
@@ -34,6 +35,9 @@ JoyAccelerometerSensor::JoyAccelerometerSensor(double rate, int originset, SetJo
     reset();
     populateButtons();
     m_rate = qFuzzyIsNull(rate) ? PT1Filter::FALLBACK_RATE : rate;
+
+    for (auto &filter : m_gravity_filter)
+        filter = PT1Filter(GRAVITY_TAU, m_rate);
 }
 
 JoyAccelerometerSensor::~JoyAccelerometerSensor() {}
@@ -62,6 +66,31 @@ float JoyAccelerometerSensor::getZCoordinate() const { return m_current_value[2]
  */
 QString JoyAccelerometerSensor::sensorTypeName() const { return tr("Accelerometer"); }
 
+/**
+ * @brief Tracks the gravity vector before queueing the event.
+ *  Uncalibrated values are used so it stays in the frame of the gyroscope.
+ */
+void JoyAccelerometerSensor::queuePendingEvent(float *values, bool ignoresets, quint64 timestampUs)
+{
+    for (int i = 0; i < 3; ++i)
+        m_gravity_filter[i].process(values[i]);
+
+    JoySensor::queuePendingEvent(values, ignoresets, timestampUs);
+}
+
+/**
+ * @brief Get the low pass filtered acceleration, which is dominated by gravity.
+ * @param[out] x X axis value in m/s^2
+ * @param[out] y Y axis value in m/s^2
+ * @param[out] z Z axis value in m/s^2
+ */
+void JoyAccelerometerSensor::getGravity(double *x, double *y, double *z) const
+{
+    *x = m_gravity_filter[0].getValue();
+    *y = m_gravity_filter[1].getValue();
+    *z = m_gravity_filter[2].getValue();
+}
+
 /**
  * @brief Reads the calibration values of the sensor
  * @param[out] offsetX Offset angle around the X axis
@@ -117,6 +146,9 @@ void JoyAccelerometerSensor::reset()
 
     m_shock_filter.reset();
     m_shock_suppress_count = 0;
+
+    for (auto &filter : m_gravity_filter)
+        filter.reset();
 }
 
 /**
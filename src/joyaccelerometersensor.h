@@ -35,6 +35,9 @@ class JoyAccelerometerSensor : public JoySensor
     virtual float getZCoordinate() const override;
     virtual QString sensorTypeName() const override;
 
+    virtual void queuePendingEvent(float *values, bool ignoresets = false, quint64 timestampUs = 0) override;
+    void getGravity(double *x, double *y, double *z) const;
+
     virtual void getCalibration(double *offsetX, double *offsetY, double *offsetZ) const override;
     virtual void setCalibration(double offsetX, double offsetY, double offsetZ) override;
 
@@ -45,6 +48,7 @@ class JoyAccelerometerSensor : public JoySensor
     static const double SHOCK_DETECT_THRESHOLD;
     static const double SHOCK_SUPPRESS_FACTOR;
     static const double SHOCK_TAU;
+    static const double GRAVITY_TAU;
 
     virtual void populateButtons() override;
     virtual JoySensorDirection calculateSensorDirection() override;
@@ -52,6 +56,7 @@ class JoyAccelerometerSensor : public JoySensor
 
     double m_rate;
     PT1Filter m_shock_filter;
+    PT1Filter m_gravity_filter[3];
     size_t m_shock_suppress_count;
     double m_calibration_matrix[3][3];
 };
@@ -20,6 +20,7 @@
 
 #include "event.h"
 #include "globalvariables.h"
+#include "guitelemetry.h"
 #include "inputdevice.h"
 #include "joyaxis.h"
 #include "joycontrolstick.h"
@@ -124,6 +125,7 @@ void JoyAxis::stickPassEvent(int value, bool ignoresets, bool updateLastValues)
             m_stick->joyEvent(ignoresets);
 
         emit moved(currentRawValue);
+        GuiTelemetry::publishAxis(this, currentRawValue);
     }
 }
 
@@ -174,6 +176,7 @@ void JoyAxis::joyEvent(int value, bool ignoresets, bool updateLastValues)
     }
 
     emit moved(currentRawValue);
+    GuiTelemetry::publishAxis(this, currentRawValue);
 }
 
 bool JoyAxis::inDeadZone(int value)
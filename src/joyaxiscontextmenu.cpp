@@ -42,7 +42,7 @@ void JoyAxisContextMenu::buildMenu()
 {
     bool actAsTrigger = false;
 
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     if ((axis->getThrottle() == static_cast<int>(JoyAxis::PositiveThrottle)) ||
         (axis->getThrottle() == static_cast<int>(JoyAxis::PositiveHalfThrottle)))
@@ -50,7 +50,7 @@ void JoyAxisContextMenu::buildMenu()
         actAsTrigger = true;
     }
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 
     if (actAsTrigger)
         buildTriggerMenu();
@@ -259,7 +259,7 @@ int JoyAxisContextMenu::getPresetIndex()
         result = 11;
     }
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 
     return result;
 }
@@ -411,7 +411,7 @@ int JoyAxisContextMenu::getTriggerPresetIndex()
 {
     int result = 0;
 
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     JoyAxisButton *paxisbutton = axis->getPAxisButton();
     QList<JoyButtonSlot *> *paxisslots = paxisbutton->getAssignedSlots();
@@ -433,7 +433,7 @@ int JoyAxisContextMenu::getTriggerPresetIndex()
         result = 3;
     }
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 
     return result;
 }
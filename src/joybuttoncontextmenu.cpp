@@ -37,7 +37,7 @@ JoyButtonContextMenu::JoyButtonContextMenu(JoyButton *button, QWidget *parent)
 
 void JoyButtonContextMenu::buildMenu()
 {
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     QAction *action = this->addAction(tr("Toggle"));
     action->setCheckable(true);
@@ -90,7 +90,7 @@ void JoyButtonContextMenu::buildMenu()
             tempSetMenu->setEnabled(false);
     }
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 }
 
 void JoyButtonContextMenu::createActionForGroup(QActionGroup *tempGroup, QString actionText, QAction *action,
@@ -114,16 +114,16 @@ void JoyButtonContextMenu::createActionForGroup(QActionGroup *tempGroup, QString
 
 void JoyButtonContextMenu::switchToggle()
 {
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
     button->setToggle(!button->getToggleState());
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 }
 
 void JoyButtonContextMenu::switchTurbo()
 {
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
     button->setUseTurbo(!button->isUsingTurbo());
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 }
 
 void JoyButtonContextMenu::switchSetMode(QAction *action)
@@ -148,21 +148,21 @@ void JoyButtonContextMenu::switchSetMode(QAction *action)
         break;
     }
 
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     // First, remove old condition for the button in both sets.
     // After that, make the new assignment.
     button->setChangeSetCondition(JoyButton::SetChangeDisabled);
     button->setChangeSetSelection(setSelection);
     button->setChangeSetCondition(temp);
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 }
 
 void JoyButtonContextMenu::disableSetMode()
 {
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
     button->setChangeSetCondition(JoyButton::SetChangeDisabled);
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 }
 
 void JoyButtonContextMenu::clearButton() { QMetaObject::invokeMethod(button, "clearSlotsEventReset"); }
@@ -18,7 +18,9 @@
 
 #include "joybuttonmousehelper.h"
 
+#include "eventhandlerfactory.h"
 #include "globalvariables.h"
+#include "inputdevice.h"
 #include "joybuttontypes/joybutton.h"
 
 #include <QDebug>
@@ -42,10 +44,12 @@ void JoyButtonMouseHelper::moveMouseCursor()
     JoyButton::moveMouseCursor(finalx, finaly, elapsedTime, &GlobalVariables::JoyButton::mouseHistoryX,
                                &GlobalVariables::JoyButton::mouseHistoryY, JoyButton::getTestOldMouseTime(),
                                JoyButton::getStaticMouseEventTimer(), GlobalVariables::JoyButton::mouseRefreshRate,
-                               GlobalVariables::JoyButton::mouseHistorySize, JoyButton::getCursorXSpeeds(),
-                               JoyButton::getCursorYSpeeds(), GlobalVariables::JoyButton::cursorRemainderX,
-                               GlobalVariables::JoyButton::cursorRemainderY, GlobalVariables::JoyButton::weightModifier,
-                               GlobalVariables::JoyButton::IDLEMOUSEREFRESHRATE, JoyButton::getPendingMouseButtons());
+                               JoyButton::getCursorXSpeeds(), JoyButton::getCursorYSpeeds(),
+                               GlobalVariables::JoyButton::cursorRemainderX, GlobalVariables::JoyButton::cursorRemainderY,
+                               GlobalVariables::JoyButton::cursorSubpixelRemainderX,
+                               GlobalVariables::JoyButton::cursorSubpixelRemainderY,
+                               GlobalVariables::JoyButton::weightModifier, GlobalVariables::JoyButton::IDLEMOUSEREFRESHRATE,
+                               JoyButton::getPendingMouseButtons(), GlobalVariables::JoyButton::highResolutionMouse);
 
     if ((finalx != 0) || (finaly != 0))
         emit mouseCursorMoved(finalx, finaly, elapsedTime);
@@ -73,6 +77,13 @@ void JoyButtonMouseHelper::moveSpringMouse()
  */
 void JoyButtonMouseHelper::mouseEvent()
 {
+    // Pending buttons can belong to devices running on their own threads.
+    InputDevice::lockAllDevices();
+    JoyButton::lockSharedState();
+
+    BaseEventHandler *eventHandler = EventHandlerFactory::getInstance()->handler();
+    eventHandler->beginBatch();
+
     if (!JoyButton::hasCursorEvents(JoyButton::getCursorXSpeeds(), JoyButton::getCursorYSpeeds()) &&
         !JoyButton::hasSpringEvents(JoyButton::getSpringXSpeeds(), JoyButton::getSpringYSpeeds()))
     {
@@ -95,16 +106,27 @@ void JoyButtonMouseHelper::mouseEvent()
 
     JoyButton::restartLastMouseTime(JoyButton::getTestOldMouseTime());
     firstSpringEvent = false;
+
+    eventHandler->endBatch();
+
+    JoyButton::unlockSharedState();
+    InputDevice::unlockAllDevices();
 }
 
 void JoyButtonMouseHelper::resetButtonMouseDistances()
 {
+    InputDevice::lockAllDevices();
+    JoyButton::lockSharedState();
+
     QList<JoyButton *> *buttonList = JoyButton::getPendingMouseButtons();
 
     for (JoyButton *temp : *buttonList)
     {
         temp->resetAccelerationDistances();
     }
+
+    JoyButton::unlockSharedState();
+    InputDevice::unlockAllDevices();
 }
 
 void JoyButtonMouseHelper::setFirstSpringStatus(bool status) { firstSpringEvent = status; }
@@ -113,6 +135,11 @@ bool JoyButtonMouseHelper::getFirstSpringStatus() { return firstSpringEvent; }
 
 void JoyButtonMouseHelper::carryGamePollRateUpdate(int pollRate) { emit gamepadRefreshRateUpdated(pollRate); }
 
+void JoyButtonMouseHelper::carryGameWaitForEventsUpdate(bool waitForEvents)
+{
+    emit gamepadWaitForEventsUpdated(waitForEvents);
+}
+
 void JoyButtonMouseHelper::carryMouseRefreshRateUpdate(int refreshRate) { emit mouseRefreshRateUpdated(refreshRate); }
 
 void JoyButtonMouseHelper::changeThread(QThread *thread)
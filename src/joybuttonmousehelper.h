@@ -33,12 +33,14 @@ class JoyButtonMouseHelper : public QObject
     void setFirstSpringStatus(bool status);
     bool getFirstSpringStatus();
     void carryGamePollRateUpdate(int pollRate);
+    void carryGameWaitForEventsUpdate(bool waitForEvents);
     void carryMouseRefreshRateUpdate(int refreshRate);
 
   signals:
     void mouseCursorMoved(int mouseX, int mouseY, int elapsed);
     void mouseSpringMoved(int mouseX, int mouseY);
     void gamepadRefreshRateUpdated(int pollRate);
+    void gamepadWaitForEventsUpdated(bool waitForEvents);
     void mouseRefreshRateUpdated(int refreshRate);
 
   public slots:
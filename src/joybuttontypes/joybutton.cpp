@@ -20,7 +20,9 @@
 
 #include "event.h"
 #include "inputdevice.h"
+#include "latencytracer.h"
 #include "logger.h"
+#include "mouseoutputthread.h"
 #include "setjoystick.h"
 #include "vdpad.h"
 
@@ -47,13 +49,13 @@ JoyButtonSlot *JoyButton::lastActiveKey = nullptr;
 // Keep track of active Mouse Speed Mod slots.
 QList<JoyButtonSlot *> JoyButton::mouseSpeedModList;
 
-// Lists used for cursor mode calculations.
-QList<JoyButton::mouseCursorInfo> JoyButton::cursorXSpeeds;
-QList<JoyButton::mouseCursorInfo> JoyButton::cursorYSpeeds;
+// Accumulators used for cursor mode calculations.
+JoyButton::CursorSpeeds JoyButton::cursorXSpeeds;
+JoyButton::CursorSpeeds JoyButton::cursorYSpeeds;
 
-// Lists used for spring mode calculations.
-QList<PadderCommon::springModeInfo> JoyButton::springXSpeeds;
-QList<PadderCommon::springModeInfo> JoyButton::springYSpeeds;
+// Accumulators used for spring mode calculations.
+JoyButton::SpringSpeeds JoyButton::springXSpeeds;
+JoyButton::SpringSpeeds JoyButton::springYSpeeds;
 
 // Temporary test object to test old mouse time behavior.
 QElapsedTimer JoyButton::testOldMouseTime;
@@ -71,6 +73,14 @@ JoyButtonMouseHelper JoyButton::mouseHelper;
 QTimer JoyButton::staticMouseEventTimer;
 QList<JoyButton *> JoyButton::pendingMouseButtons;
 
+// Guards the static state above when input devices run on their own
+// threads. Button events nest through set changes, so it is recursive.
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+QRecursiveMutex JoyButton::sharedStateMutex;
+#else
+QMutex JoyButton::sharedStateMutex(QMutex::Recursive);
+#endif
+
 // IT CAN BE HERE
 // LOOK FOR JoyCycle and put JoyMix next to the slots types
 JoyButton::JoyButton(int sdl_button_index, int originset, SetJoystick *parentSet, QObject *parent)
@@ -81,33 +91,23 @@ JoyButton::JoyButton(int sdl_button_index, int originset, SetJoystick *parentSet
 
     threadPool = QThreadPool::globalInstance();
 
-    turboTimer.setParent(this);
-    pauseTimer.setParent(this);
-    holdTimer.setParent(this);
-    pauseWaitTimer.setParent(this);
-    createDeskTimer.setParent(this);
-    releaseDeskTimer.setParent(this);
-    mouseWheelVerticalEventTimer.setParent(this);
-    mouseWheelHorizontalEventTimer.setParent(this);
-    setChangeTimer.setParent(this);
-    keyPressTimer.setParent(this);
-    delayTimer.setParent(this);
-    slotSetChangeTimer.setParent(this);
     setChangeTimer.setSingleShot(true);
     slotSetChangeTimer.setSingleShot(true);
     m_parentSet = parentSet;
 
-    connect(&pauseWaitTimer, &QTimer::timeout, this, &JoyButton::pauseWaitEvent);
-    connect(&keyPressTimer, &QTimer::timeout, this, &JoyButton::keyPressEvent);
-    connect(&holdTimer, &QTimer::timeout, this, &JoyButton::holdEvent);
-    connect(&delayTimer, &QTimer::timeout, this, &JoyButton::delayEvent);
-    connect(&createDeskTimer, &QTimer::timeout, this, &JoyButton::waitForDeskEvent);
-    connect(&releaseDeskTimer, &QTimer::timeout, this, &JoyButton::waitForReleaseDeskEvent);
-    connect(&turboTimer, &QTimer::timeout, this, &JoyButton::turboEvent);
-    connect(&mouseWheelVerticalEventTimer, &QTimer::timeout, this, &JoyButton::wheelEventVertical);
-    connect(&mouseWheelHorizontalEventTimer, &QTimer::timeout, this, &JoyButton::wheelEventHorizontal);
-    connect(&setChangeTimer, &QTimer::timeout, this, &JoyButton::checkForSetChange);
-    connect(&slotSetChangeTimer, &QTimer::timeout, this, &JoyButton::slotSetChange);
+    // Button timers share the timer wheel of the input thread instead of
+    // each one being a QObject registered with the event dispatcher.
+    pauseWaitTimer.setCallback<JoyButton, &JoyButton::pauseWaitEvent>(this);
+    keyPressTimer.setCallback<JoyButton, &JoyButton::keyPressEvent>(this);
+    holdTimer.setCallback<JoyButton, &JoyButton::holdEvent>(this);
+    delayTimer.setCallback<JoyButton, &JoyButton::delayEvent>(this);
+    createDeskTimer.setCallback<JoyButton, &JoyButton::waitForDeskEvent>(this);
+    releaseDeskTimer.setCallback<JoyButton, &JoyButton::waitForReleaseDeskEvent>(this);
+    turboTimer.setCallback<JoyButton, &JoyButton::turboEvent>(this);
+    mouseWheelVerticalEventTimer.setCallback<JoyButton, &JoyButton::wheelEventVertical>(this);
+    mouseWheelHorizontalEventTimer.setCallback<JoyButton, &JoyButton::wheelEventHorizontal>(this);
+    setChangeTimer.setCallback<JoyButton, &JoyButton::checkForSetChange>(this);
+    slotSetChangeTimer.setCallback<JoyButton, &JoyButton::slotSetChange>(this);
 
     // Will only matter on the first call
     establishMouseTimerConnections();
@@ -175,6 +175,9 @@ void JoyButton::vdpadPassEvent(bool pressed, bool ignoresets)
  */
 void JoyButton::joyEvent(bool pressed, bool ignoresets)
 {
+    lockSharedState();
+    LatencyTracer::mark(LatencyTracer::JOY_EVENT);
+
     if (Logger::isDebugEnabled())
         DEBUG() << "Processing JoyButton::joyEvent for: " << getName() << " SDL index: " << m_index_sdl
                 << " className: " << metaObject()->className();
@@ -302,6 +305,7 @@ void JoyButton::joyEvent(bool pressed, bool ignoresets)
     }
 
     updateInitAccelValues = true;
+    unlockSharedState();
 }
 
 void JoyButton::updateParamsAfterDistEvent()
@@ -580,6 +584,8 @@ void JoyButton::createDeskEvent()
 
 void JoyButton::activateSlots()
 {
+    LatencyTracer::mark(LatencyTracer::SLOT_ACTIVATION);
+
     bool countForAllTime = false;
 
     if (allSlotTimeBetweenSlots == 0)
@@ -778,7 +784,14 @@ void JoyButton::addEachSlotToActives(JoyButtonSlot *slot, int &i, bool &delaySeq
                 int tempRate =
                     qBound(0, GlobalVariables::JoyButton::mouseRefreshRate - GlobalVariables::JoyButton::gamepadRefreshRate,
                            GlobalVariables::JoyButton::MAXIMUMMOUSEREFRESHRATE);
-                staticMouseEventTimer.start(tempRate);
+
+                // Buttons of devices with their own input thread have to
+                // start the timer in the thread of the mouse helper.
+                if (QThread::currentThread() == staticMouseEventTimer.thread())
+                    staticMouseEventTimer.start(tempRate);
+                else
+                    QMetaObject::invokeMethod(&staticMouseEventTimer, "start", Qt::QueuedConnection, Q_ARG(int, tempRate));
+
                 testOldMouseTime.restart();
                 accelExtraDurationTime.restart();
             }
@@ -1341,15 +1354,8 @@ void JoyButton::mouseEvent()
                         break;
                     }
 
-                    mouseCursorInfo infoX;
-                    infoX.code = mouse1;
-                    infoX.slot = buttonslot;
-                    cursorXSpeeds.append(infoX);
-
-                    mouseCursorInfo infoY;
-                    infoY.code = mouse2;
-                    infoY.slot = buttonslot;
-                    cursorYSpeeds.append(infoY);
+                    addCursorSpeed(cursorXSpeeds, buttonslot, mouse1);
+                    addCursorSpeed(cursorYSpeeds, buttonslot, mouse2);
                     sumDist = 0;
 
                     buttonslot->setDistance(sumDist);
@@ -1422,8 +1428,8 @@ void JoyButton::setDistanceForSpring(JoyButtonMouseHelper &mouseHelper, double &
 }
 
 void JoyButton::updateMouseProperties(double newAxisValue, double newSpringDead, int newSpringWidth, int newSpringHeight,
-                                      bool relatived, int modeScreen, QList<PadderCommon::springModeInfo> &springSpeeds,
-                                      QChar axis, double newAxisValueY, double newSpringDeadY)
+                                      bool relatived, int modeScreen, JoyButton::SpringSpeeds &springSpeeds, QChar axis,
+                                      double newAxisValueY, double newSpringDeadY)
 {
     PadderCommon::springModeInfo axisInfo;
 
@@ -1449,7 +1455,10 @@ void JoyButton::updateMouseProperties(double newAxisValue, double newSpringDead,
     axisInfo.height = newSpringHeight;
     axisInfo.relative = relatived;
     axisInfo.screen = modeScreen;
-    springSpeeds.append(axisInfo);
+
+    if (!springSpeeds.append(axisInfo))
+        DEBUG() << "Spring speed buffer is full, the oldest entry was dropped. Overflow count: "
+                << springSpeeds.getOverflowCount();
 }
 
 void JoyButton::wheelEventVertical()
@@ -2728,7 +2737,8 @@ void JoyButton::holdEvent()
     }
 }
 
-void JoyButton::startTimerOverrun(int slotCode, QElapsedTimer *currSlotTime, QTimer *currSlotTimer, bool releasedDeskTimer)
+void JoyButton::startTimerOverrun(int slotCode, QElapsedTimer *currSlotTime, WheelTimer *currSlotTimer,
+                                  bool releasedDeskTimer)
 {
     int proposedInterval = slotCode - currSlotTime->elapsed();
     proposedInterval = (proposedInterval > 0) ? proposedInterval : 0;
@@ -3172,6 +3182,8 @@ void JoyButton::releaseActiveSlots()
         {
             GlobalVariables::JoyButton::cursorRemainderX = 0;
             GlobalVariables::JoyButton::cursorRemainderY = 0;
+            GlobalVariables::JoyButton::cursorSubpixelRemainderX = 0;
+            GlobalVariables::JoyButton::cursorSubpixelRemainderY = 0;
         }
     }
 }
@@ -3211,10 +3223,8 @@ void JoyButton::releaseEachSlot(bool &changeRepeatState, int &references, int te
 
         if (mousemode == MouseCursor)
         {
-            QList<int> indexesToRemove;
-
-            releaseMoveSlots(cursorXSpeeds, slot, indexesToRemove);
-            releaseMoveSlots(cursorYSpeeds, slot, indexesToRemove);
+            // Movement the slot collected before its release is still sent
+            // with the next mouse event.
             slot->getEasingTime()->restart();
             slot->setEasingStatus(false);
         } else if (mousemode == JoyButton::MouseSpring)
@@ -3304,28 +3314,19 @@ void JoyButton::checkSpringDeadCircle(int tempcode, double &springDeadCircle, in
     }
 }
 
-void JoyButton::releaseMoveSlots(QList<JoyButton::mouseCursorInfo> &cursorSpeeds, JoyButtonSlot *slot,
-                                 QList<int> &indexesToRemove)
+/**
+ * @brief Adds the displacement of a slot to the current mouse event interval.
+ *  A slot which already moved during the interval keeps a single entry.
+ */
+void JoyButton::addCursorSpeed(JoyButton::CursorSpeeds &cursorSpeeds, JoyButtonSlot *slot, double code)
 {
-    QListIterator<mouseCursorInfo> iter(cursorSpeeds);
-    int i = cursorSpeeds.length();
-
-    while (iter.hasNext())
-    {
-        mouseCursorInfo info = iter.next();
-        if (info.slot == slot)
-            indexesToRemove.append(i);
-        i++;
-    }
-
-    QListIterator<int> removeIter(indexesToRemove);
-    while (removeIter.hasPrevious())
-    {
-        int index = removeIter.previous();
-        cursorSpeeds.removeAt(index);
-    }
+    mouseCursorInfo *info = cursorSpeeds.findLast([slot](const mouseCursorInfo &entry) { return entry.slot == slot; });
 
-    indexesToRemove.clear();
+    if (info != nullptr)
+        info->code += code;
+    else if (!cursorSpeeds.append(mouseCursorInfo{slot, code}))
+        DEBUG() << "Cursor speed buffer is full, the oldest entry was dropped. Overflow count: "
+                << cursorSpeeds.getOverflowCount();
 }
 
 bool JoyButton::containsReleaseSlots()
@@ -3621,12 +3622,12 @@ QString JoyButton::getDefaultButtonName() { return defaultButtonName; }
  * @brief Take cursor mouse information provided by all buttons and
  *     send a cursor mode mouse event to the display server.
  */
-void JoyButton::moveMouseCursor(int &movedX, int &movedY, int &movedElapsed, QList<double> *mouseHistoryX,
-                                QList<double> *mouseHistoryY, QElapsedTimer *testOldMouseTime, QTimer *staticMouseEventTimer,
-                                int mouseRefreshRate, int mouseHistorySize, QList<JoyButton::mouseCursorInfo> *cursorXSpeeds,
-                                QList<JoyButton::mouseCursorInfo> *cursorYSpeeds, double &cursorRemainderX,
-                                double &cursorRemainderY, double weightModifier, int idleMouseRefrRate,
-                                QList<JoyButton *> *pendingMouseButtons)
+void JoyButton::moveMouseCursor(int &movedX, int &movedY, int &movedElapsed, MouseHistory *mouseHistoryX,
+                                MouseHistory *mouseHistoryY, QElapsedTimer *testOldMouseTime, QTimer *staticMouseEventTimer,
+                                int mouseRefreshRate, JoyButton::CursorSpeeds *cursorXSpeeds,
+                                JoyButton::CursorSpeeds *cursorYSpeeds, double &cursorRemainderX, double &cursorRemainderY,
+                                qint64 &subpixelRemainderX, qint64 &subpixelRemainderY, double weightModifier,
+                                int idleMouseRefrRate, QList<JoyButton *> *pendingMouseButtons, bool highResolution)
 {
     movedX = 0;
     movedY = 0;
@@ -3636,12 +3637,6 @@ void JoyButton::moveMouseCursor(int &movedX, int &movedY, int &movedElapsed, QLi
     if (staticMouseEventTimer->interval() < mouseRefreshRate)
         movedElapsed = mouseRefreshRate + (elapsedTime - staticMouseEventTimer->interval());
 
-    if (mouseHistoryX->size() >= mouseHistorySize)
-        mouseHistoryX->removeLast();
-
-    if (mouseHistoryY->size() >= mouseHistorySize)
-        mouseHistoryY->removeLast();
-
     /*
      * Combine all mouse events to find the distance to move the mouse
      * along the X and Y axis. If necessary, perform mouse smoothing.
@@ -3656,8 +3651,8 @@ void JoyButton::moveMouseCursor(int &movedX, int &movedY, int &movedElapsed, QLi
 
         for (int i = 0; i < queueLength; i++)
         {
-            mouseCursorInfo infoX = cursorXSpeeds->takeFirst();
-            mouseCursorInfo infoY = cursorYSpeeds->takeFirst();
+            const mouseCursorInfo &infoX = cursorXSpeeds->at(i);
+            const mouseCursorInfo &infoY = cursorYSpeeds->at(i);
 
             distanceForMovingAx(finalx, infoX);
             distanceForMovingAx(finaly, infoY);
@@ -3666,47 +3661,61 @@ void JoyButton::moveMouseCursor(int &movedX, int &movedY, int &movedElapsed, QLi
             infoY.slot->getMouseInterval()->restart();
         }
 
-        // Only apply remainder if both current displacement and remainder
-        // follow the same direction.
-        if ((cursorRemainderX >= 0) == (finalx >= 0))
-            finalx += cursorRemainderX;
-
-        // Cap maximum relative mouse movement.
-        if (abs(finalx) > 127)
-            finalx = (finalx < 0) ? -127 : 127;
-
-        mouseHistoryX->prepend(finalx);
-
-        // Only apply remainder if both current displacement and remainder
-        // follow the same direction.
-        if ((cursorRemainderY >= 0) == (finaly >= 0))
-            finaly += cursorRemainderY;
-
-        // Cap maximum relative mouse movement.
-        if (abs(finaly) > 127)
-            finaly = (finaly < 0) ? -127 : 127;
+        // High resolution output adds the remainder after smoothing and
+        // does not cap the movement.
+        if (!highResolution)
+        {
+            // Only apply remainder if both current displacement and remainder
+            // follow the same direction.
+            if ((cursorRemainderX >= 0) == (finalx >= 0))
+                finalx += cursorRemainderX;
+
+            // Cap maximum relative mouse movement.
+            if (abs(finalx) > 127)
+                finalx = (finalx < 0) ? -127 : 127;
+
+            // Only apply remainder if both current displacement and remainder
+            // follow the same direction.
+            if ((cursorRemainderY >= 0) == (finaly >= 0))
+                finaly += cursorRemainderY;
+
+            // Cap maximum relative mouse movement.
+            if (abs(finaly) > 127)
+                finaly = (finaly < 0) ? -127 : 127;
+        }
 
-        mouseHistoryY->prepend(finaly);
+        mouseHistoryX->push(finalx, weightModifier);
+        mouseHistoryY->push(finaly, weightModifier);
 
-        cursorRemainderX = 0;
-        cursorRemainderY = 0;
         double adjustedX = 0;
         double adjustedY = 0;
 
-        adjustAxForCursor(mouseHistoryX, adjustedX, cursorRemainderX, weightModifier);
-        adjustAxForCursor(mouseHistoryY, adjustedY, cursorRemainderY, weightModifier);
+        if (highResolution)
+        {
+            adjustAxForHighResCursor(mouseHistoryX, adjustedX, subpixelRemainderX);
+            adjustAxForHighResCursor(mouseHistoryY, adjustedY, subpixelRemainderY);
+        } else
+        {
+            cursorRemainderX = 0;
+            cursorRemainderY = 0;
+            adjustAxForCursor(mouseHistoryX, adjustedX, cursorRemainderX);
+            adjustAxForCursor(mouseHistoryY, adjustedY, cursorRemainderY);
+        }
 
         // This check is more of a precaution than anything. No need to cause
         // a sync to happen when not needed.
         if (!qFuzzyIsNull(adjustedX) || !qFuzzyIsNull(adjustedY))
-            sendevent(adjustedX, adjustedY);
+        {
+            if (!MouseOutputThread::submit(adjustedX, adjustedY, mouseRefreshRate))
+                sendevent(adjustedX, adjustedY);
+        }
 
         movedX = adjustedX;
         movedY = adjustedY;
     } else
     {
-        mouseHistoryX->prepend(0);
-        mouseHistoryY->prepend(0);
+        mouseHistoryX->push(0, weightModifier);
+        mouseHistoryY->push(0, weightModifier);
     }
 
     // Check if mouse event timer should use idle time.
@@ -3716,20 +3725,15 @@ void JoyButton::moveMouseCursor(int &movedX, int &movedY, int &movedElapsed, QLi
         {
             staticMouseEventTimer->start(idleMouseRefrRate);
 
-            // Clear current mouse history
-            mouseHistoryX->clear();
-            mouseHistoryY->clear();
-
-            // Fill history with zeroes.
-            for (int i = 0; i < mouseHistorySize; i++)
-            {
-                mouseHistoryX->append(0);
-                mouseHistoryY->append(0);
-            }
+            // Replace current mouse history with zeroes.
+            mouseHistoryX->fillWithZeros(weightModifier);
+            mouseHistoryY->fillWithZeros(weightModifier);
         }
 
         cursorRemainderX = 0;
         cursorRemainderY = 0;
+        subpixelRemainderX = 0;
+        subpixelRemainderY = 0;
     } else
     {
         if (staticMouseEventTimer->interval() != mouseRefreshRate)
@@ -3751,23 +3755,12 @@ void JoyButton::distanceForMovingAx(double &finalAx, mouseCursorInfo infoAx)
         finalAx += infoAx.code;
 }
 
-void JoyButton::adjustAxForCursor(QList<double> *mouseHistoryList, double &adjustedAx, double &cursorRemainder,
-                                  double weightModifier)
+void JoyButton::adjustAxForCursor(MouseHistory *mouseHistory, double &adjustedAx, double &cursorRemainder)
 {
-    double currentWeight = 1.0;
-    double finalWeight = 0.0;
-
-    QListIterator<double> mouseHist(*mouseHistoryList);
-    while (mouseHist.hasNext())
-    {
-        adjustedAx += mouseHist.next() * currentWeight;
-        finalWeight += currentWeight;
-        currentWeight *= weightModifier;
-    }
+    adjustedAx = mouseHistory->weightedAverage();
 
     if (fabs(adjustedAx) > 0)
     {
-        adjustedAx = adjustedAx / finalWeight;
         double oldAx = adjustedAx;
 
         if (adjustedAx > 0)
@@ -3779,14 +3772,30 @@ void JoyButton::adjustAxForCursor(QList<double> *mouseHistoryList, double &adjus
     }
 }
 
+/**
+ * @brief Splits the smoothed displacement into whole pixels and a remainder.
+ *  The remainder is kept as an integer count of 1/CURSORSUBPIXELS pixels
+ *  and carried regardless of its direction, so slow movement is not lost to
+ *  rounding and the sent movement adds up to the computed one.
+ */
+void JoyButton::adjustAxForHighResCursor(MouseHistory *mouseHistory, double &adjustedAx, qint64 &subpixelRemainder)
+{
+    const qint64 subpixels = GlobalVariables::JoyButton::CURSORSUBPIXELS;
+    qint64 total = qRound64(mouseHistory->weightedAverage() * subpixels) + subpixelRemainder;
+    qint64 whole = total / subpixels;
+
+    adjustedAx = static_cast<double>(whole);
+    subpixelRemainder = total - (whole * subpixels);
+}
+
 /**
  * @brief Take spring mouse information provided by all buttons and
  *     send a spring mode mouse event to the display server.
  */
 void JoyButton::moveSpringMouse(int &movedX, int &movedY, bool &hasMoved, int springModeScreen,
-                                QList<PadderCommon::springModeInfo> *springXSpeeds,
-                                QList<PadderCommon::springModeInfo> *springYSpeeds, QList<JoyButton *> *pendingMouseButtons,
-                                int mouseRefreshRate, int idleMouseRefrRate, QTimer *staticMouseEventTimer)
+                                JoyButton::SpringSpeeds *springXSpeeds, JoyButton::SpringSpeeds *springYSpeeds,
+                                QList<JoyButton *> *pendingMouseButtons, int mouseRefreshRate, int idleMouseRefrRate,
+                                QTimer *staticMouseEventTimer)
 {
     PadderCommon::springModeInfo fullSpring = {-2.0, -2.0, 0, 0, false, springModeScreen, 0.0, 0.0};
 
@@ -3805,11 +3814,8 @@ void JoyButton::moveSpringMouse(int &movedX, int &movedY, bool &hasMoved, int sp
             double tempSpringDeadX = 0.0;
             double tempSpringDeadY = 0.0;
 
-            PadderCommon::springModeInfo infoX;
-            PadderCommon::springModeInfo infoY;
-
-            infoX = springXSpeeds->takeLast();
-            infoY = springYSpeeds->takeLast();
+            const PadderCommon::springModeInfo &infoX = springXSpeeds->at(i);
+            const PadderCommon::springModeInfo &infoY = springYSpeeds->at(i);
 
             double tempx = infoX.displacementX;
             double tempy = infoY.displacementY;
@@ -4198,30 +4204,37 @@ JoyButtonMouseHelper *JoyButton::getMouseHelper() { return &mouseHelper; }
  */
 QList<JoyButton *> *JoyButton::getPendingMouseButtons() { return &pendingMouseButtons; }
 
-QList<JoyButton::mouseCursorInfo> *JoyButton::getCursorXSpeeds() { return &cursorXSpeeds; }
+JoyButton::CursorSpeeds *JoyButton::getCursorXSpeeds() { return &cursorXSpeeds; }
 
-QList<JoyButton::mouseCursorInfo> *JoyButton::getCursorYSpeeds() { return &cursorYSpeeds; }
+JoyButton::CursorSpeeds *JoyButton::getCursorYSpeeds() { return &cursorYSpeeds; }
 
-QList<PadderCommon::springModeInfo> *JoyButton::getSpringXSpeeds() { return &springXSpeeds; }
+JoyButton::SpringSpeeds *JoyButton::getSpringXSpeeds() { return &springXSpeeds; }
 
-QList<PadderCommon::springModeInfo> *JoyButton::getSpringYSpeeds() { return &springYSpeeds; }
+JoyButton::SpringSpeeds *JoyButton::getSpringYSpeeds() { return &springYSpeeds; }
 
 QTimer *JoyButton::getStaticMouseEventTimer() { return &staticMouseEventTimer; }
 
 QElapsedTimer *JoyButton::getTestOldMouseTime() { return &testOldMouseTime; }
 
-bool JoyButton::hasCursorEvents(QList<JoyButton::mouseCursorInfo> *cursorXSpeedsList,
-                                QList<JoyButton::mouseCursorInfo> *cursorYSpeedsList)
+/**
+ * @brief Locks the state all buttons share, like the pending mouse speeds.
+ *  Needed when input devices run on their own threads. joyEvent() and the
+ *  button timers of device threads take it on their own.
+ */
+void JoyButton::lockSharedState() { sharedStateMutex.lock(); }
+
+void JoyButton::unlockSharedState() { sharedStateMutex.unlock(); }
+
+bool JoyButton::hasCursorEvents(JoyButton::CursorSpeeds *cursorXSpeedsList, JoyButton::CursorSpeeds *cursorYSpeedsList)
 {
     //  qInstallMessageHandler(MessageHandler::myMessageOutput);
 
-    return (cursorXSpeedsList->length() != 0) || (cursorYSpeedsList->length() != 0);
+    return !cursorXSpeedsList->isEmpty() || !cursorYSpeedsList->isEmpty();
 }
 
-bool JoyButton::hasSpringEvents(QList<PadderCommon::springModeInfo> *springXSpeedsList,
-                                QList<PadderCommon::springModeInfo> *springYSpeedsList)
+bool JoyButton::hasSpringEvents(JoyButton::SpringSpeeds *springXSpeedsList, JoyButton::SpringSpeeds *springYSpeedsList)
 {
-    return (springXSpeedsList->length() != 0) || (springYSpeedsList->length() != 0);
+    return !springXSpeedsList->isEmpty() || !springYSpeedsList->isEmpty();
 }
 
 /**
@@ -4238,13 +4251,13 @@ void JoyButton::setWeightModifier(double modifier, double maxWeightModifier, dou
  * @brief Set mouse history buffer size used for mouse smoothing.
  * @param Mouse history buffer size
  */
-void JoyButton::setMouseHistorySize(int size, int maxMouseHistSize, int &mouseHistSize, QList<double> *mouseHistoryX,
-                                    QList<double> *mouseHistoryY)
+void JoyButton::setMouseHistorySize(int size, int maxMouseHistSize, int &mouseHistSize, MouseHistory *mouseHistoryX,
+                                    MouseHistory *mouseHistoryY)
 {
     if ((size >= 1) && (size <= maxMouseHistSize))
     {
-        mouseHistoryX->clear();
-        mouseHistoryY->clear();
+        mouseHistoryX->setSize(size);
+        mouseHistoryY->setSize(size);
         mouseHistSize = size;
     }
 }
@@ -4254,8 +4267,8 @@ void JoyButton::setMouseHistorySize(int size, int maxMouseHistSize, int &mouseHi
  * @param Refresh rate in ms.
  */
 void JoyButton::setMouseRefreshRate(int refresh, int &mouseRefreshRate, int idleMouseRefrRate,
-                                    JoyButtonMouseHelper *mouseHelper, QList<double> *mouseHistoryX,
-                                    QList<double> *mouseHistoryY, QElapsedTimer *testOldMouseTime,
+                                    JoyButtonMouseHelper *mouseHelper, MouseHistory *mouseHistoryX,
+                                    MouseHistory *mouseHistoryY, QElapsedTimer *testOldMouseTime,
                                     QTimer *staticMouseEventTimer)
 {
     if ((refresh >= 1) && (refresh <= 16))
@@ -4301,6 +4314,20 @@ void JoyButton::setGamepadRefreshRate(int refresh, int &gamepadRefreshRate, JoyB
     }
 }
 
+/**
+ * @brief Switch between polling SDL at the gamepad poll rate and blocking
+ *   until SDL reports a new event.
+ * @param true to wait for events, false to poll.
+ */
+void JoyButton::setGamepadWaitForEvents(bool wait, bool &gamepadWaitForEvents, JoyButtonMouseHelper *mouseHelper)
+{
+    if (wait != gamepadWaitForEvents)
+    {
+        gamepadWaitForEvents = wait;
+        mouseHelper->carryGameWaitForEventsUpdate(gamepadWaitForEvents);
+    }
+}
+
 /**
  * @brief Check if turbo should be disabled for a slot
  * @param JoyButtonSlot to check
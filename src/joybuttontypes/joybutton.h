@@ -22,9 +22,12 @@
 #include "globalvariables.h"
 #include "joybuttonmousehelper.h"
 #include "joybuttonslot.h"
+#include "speedaccumulator.h"
 #include "springmousemoveinfo.h"
+#include "timerwheel.h"
 
 #include <QDeadlineTimer>
+#include <QMutex>
 #include <QQueue>
 #include <QReadWriteLock>
 #include <QRunnable>
@@ -95,6 +98,11 @@ class JoyButton : public QObject
         double code;
     } mouseCursorInfo;
 
+    // Speed contributions of one mouse event interval. Cursor speeds hold
+    // one entry per active slot.
+    typedef SpeedAccumulator<mouseCursorInfo, 64> CursorSpeeds;
+    typedef SpeedAccumulator<PadderCommon::springModeInfo, 64> SpringSpeeds;
+
     void joyEvent(bool pressed, bool ignoresets = false);          // JoyButtonEvents class
     void queuePendingEvent(bool pressed, bool ignoresets = false); // JoyButtonEvents class
     void activatePendingEvent();                                   // JoyButtonEvents class
@@ -213,33 +221,34 @@ class JoyButton : public QObject
 
     static int calculateFinalMouseSpeed(JoyMouseCurve curve, int value, const float joyspeed);
 
-    static bool hasCursorEvents(QList<JoyButton::mouseCursorInfo> *cursorXSpeedsList,
-                                QList<JoyButton::mouseCursorInfo> *cursorYSpeedsList); // JoyButtonEvents class
-    static bool hasSpringEvents(QList<PadderCommon::springModeInfo> *springXSpeedsList,
-                                QList<PadderCommon::springModeInfo> *springYSpeedsList); // JoyButtonEvents class
+    static bool hasCursorEvents(JoyButton::CursorSpeeds *cursorXSpeedsList,
+                                JoyButton::CursorSpeeds *cursorYSpeedsList); // JoyButtonEvents class
+    static bool hasSpringEvents(JoyButton::SpringSpeeds *springXSpeedsList,
+                                JoyButton::SpringSpeeds *springYSpeedsList); // JoyButtonEvents class
     static bool shouldInvokeMouseEvents(QList<JoyButton *> *pendingMouseButtons, QTimer *staticMouseEventTimer,
                                         QElapsedTimer *testOldMouseTime);
 
     static void setWeightModifier(double modifier, double maxWeightModifier, double &weightModifier);
-    static void moveMouseCursor(int &movedX, int &movedY, int &movedElapsed, QList<double> *mouseHistoryX,
-                                QList<double> *mouseHistoryY, QElapsedTimer *testOldMouseTime, QTimer *staticMouseEventTimer,
-                                int mouseRefreshRate, int mouseHistorySize, QList<JoyButton::mouseCursorInfo> *cursorXSpeeds,
-                                QList<JoyButton::mouseCursorInfo> *cursorYSpeeds, double &cursorRemainderX,
-                                double &cursorRemainderY, double weightModifier, int idleMouseRefrRate,
-                                QList<JoyButton *> *pendingMouseButtonse);
+    static void moveMouseCursor(int &movedX, int &movedY, int &movedElapsed, MouseHistory *mouseHistoryX,
+                                MouseHistory *mouseHistoryY, QElapsedTimer *testOldMouseTime, QTimer *staticMouseEventTimer,
+                                int mouseRefreshRate, JoyButton::CursorSpeeds *cursorXSpeeds,
+                                JoyButton::CursorSpeeds *cursorYSpeeds, double &cursorRemainderX, double &cursorRemainderY,
+                                qint64 &subpixelRemainderX, qint64 &subpixelRemainderY, double weightModifier,
+                                int idleMouseRefrRate, QList<JoyButton *> *pendingMouseButtonse, bool highResolution);
     static void moveSpringMouse(int &movedX, int &movedY, bool &hasMoved, int springModeScreen,
-                                QList<PadderCommon::springModeInfo> *springXSpeeds,
-                                QList<PadderCommon::springModeInfo> *springYSpeeds, QList<JoyButton *> *pendingMouseButtons,
-                                int mouseRefreshRate, int idleMouseRefrRate, QTimer *staticMouseEventTimer);
-    static void setMouseHistorySize(int size, int maxMouseHistSize, int &mouseHistSize, QList<double> *mouseHistoryX,
-                                    QList<double> *mouseHistoryY);
+                                JoyButton::SpringSpeeds *springXSpeeds, JoyButton::SpringSpeeds *springYSpeeds,
+                                QList<JoyButton *> *pendingMouseButtons, int mouseRefreshRate, int idleMouseRefrRate,
+                                QTimer *staticMouseEventTimer);
+    static void setMouseHistorySize(int size, int maxMouseHistSize, int &mouseHistSize, MouseHistory *mouseHistoryX,
+                                    MouseHistory *mouseHistoryY);
     static void setMouseRefreshRate(int refresh, int &mouseRefreshRate, int idleMouseRefrRate,
-                                    JoyButtonMouseHelper *mouseHelper, QList<double> *mouseHistoryX,
-                                    QList<double> *mouseHistoryY, QElapsedTimer *testOldMouseTime,
+                                    JoyButtonMouseHelper *mouseHelper, MouseHistory *mouseHistoryX,
+                                    MouseHistory *mouseHistoryY, QElapsedTimer *testOldMouseTime,
                                     QTimer *staticMouseEventTimer);
     static void setSpringModeScreen(int screen, int &springModeScreen);
     static void resetActiveButtonMouseDistances(JoyButtonMouseHelper *mouseHelper);
     static void setGamepadRefreshRate(int refresh, int &gamepadRefreshRate, JoyButtonMouseHelper *mouseHelper);
+    static void setGamepadWaitForEvents(bool wait, bool &gamepadWaitForEvents, JoyButtonMouseHelper *mouseHelper);
     static void restartLastMouseTime(QElapsedTimer *testOldMouseTime);
     static void setStaticMouseThread(QThread *thread, QTimer *staticMouseEventTimer, QElapsedTimer *testOldMouseTime,
                                      int idleMouseRefrRate, JoyButtonMouseHelper *mouseHelper);
@@ -248,12 +257,14 @@ class JoyButton : public QObject
 
     static JoyButtonMouseHelper *getMouseHelper();
     static QList<JoyButton *> *getPendingMouseButtons();
-    static QList<JoyButton::mouseCursorInfo> *getCursorXSpeeds();
-    static QList<JoyButton::mouseCursorInfo> *getCursorYSpeeds();
-    static QList<PadderCommon::springModeInfo> *getSpringXSpeeds();
-    static QList<PadderCommon::springModeInfo> *getSpringYSpeeds();
+    static JoyButton::CursorSpeeds *getCursorXSpeeds();
+    static JoyButton::CursorSpeeds *getCursorYSpeeds();
+    static JoyButton::SpringSpeeds *getSpringXSpeeds();
+    static JoyButton::SpringSpeeds *getSpringYSpeeds();
     static QTimer *getStaticMouseEventTimer(); // JoyButtonEvents class
     static QElapsedTimer *getTestOldMouseTime();
+    static void lockSharedState();
+    static void unlockSharedState();
 
     JoyExtraAccelerationCurve getExtraAccelerationCurve();
 
@@ -292,10 +303,10 @@ class JoyButton : public QObject
     QString buildActiveZoneSummary(QList<JoyButtonSlot *> &tempList);
 
     static QList<JoyButtonSlot *> mouseSpeedModList; // JoyButtonSlots class
-    static QList<mouseCursorInfo> cursorXSpeeds;
-    static QList<mouseCursorInfo> cursorYSpeeds;
-    static QList<PadderCommon::springModeInfo> springXSpeeds;
-    static QList<PadderCommon::springModeInfo> springYSpeeds;
+    static CursorSpeeds cursorXSpeeds;
+    static CursorSpeeds cursorYSpeeds;
+    static SpringSpeeds springXSpeeds;
+    static SpringSpeeds springYSpeeds;
     static QList<JoyButton *> pendingMouseButtons;
     static JoyButtonSlot *lastActiveKey; // JoyButtonSlots class
     static JoyButtonMouseHelper mouseHelper;
@@ -315,9 +326,9 @@ class JoyButton : public QObject
     double lastWheelVerticalDistance;
     double lastWheelHorizontalDistance;
 
-    QTimer turboTimer;
-    QTimer mouseWheelVerticalEventTimer;
-    QTimer mouseWheelHorizontalEventTimer;
+    WheelTimer turboTimer;
+    WheelTimer mouseWheelVerticalEventTimer;
+    WheelTimer mouseWheelHorizontalEventTimer;
 
     QElapsedTimer wheelVerticalTime;
     QElapsedTimer wheelHorizontalTime;
@@ -525,18 +536,18 @@ class JoyButton : public QObject
     void resetAllProperties();
     void resetPrivVars();
     void restartAllForSetChange();
-    void startTimerOverrun(int slotCode, QElapsedTimer *currSlotTime, QTimer *currSlotTimer, bool releasedDeskTimer = false);
+    void startTimerOverrun(int slotCode, QElapsedTimer *currSlotTime, WheelTimer *currSlotTimer,
+                           bool releasedDeskTimer = false);
     void findJoySlotsEnd(QListIterator<JoyButtonSlot *> *slotiter);
     void changeStatesQueue(bool currentReleased);
     void countActiveSlots(int tempcode, int &references, JoyButtonSlot *slot, QHash<int, int> &activeSlotsHash,
                           bool &changeRepeatState, bool activeSlotHashWindows = false); // JoyButtonSlots class
-    void releaseMoveSlots(QList<JoyButton::mouseCursorInfo> &cursorSpeeds, JoyButtonSlot *slot,
-                          QList<int> &indexesToRemove); // JoyButtonSlots class
+    static void addCursorSpeed(JoyButton::CursorSpeeds &cursorSpeeds, JoyButtonSlot *slot, double code);
     void setSpringDeadCircle(double &springDeadCircle, int mouseDirection);
     void checkSpringDeadCircle(int tempcode, double &springDeadCircle, int mouseSlot1, int mouseSlot2);
     static void distanceForMovingAx(double &finalAx, mouseCursorInfo infoAx);
-    static void adjustAxForCursor(QList<double> *mouseHistoryList, double &adjustedAx, double &cursorRemainder,
-                                  double weightModifier);
+    static void adjustAxForCursor(MouseHistory *mouseHistory, double &adjustedAx, double &cursorRemainder);
+    static void adjustAxForHighResCursor(MouseHistory *mouseHistory, double &adjustedAx, qint64 &subpixelRemainder);
     void setDistanceForSpring(JoyButtonMouseHelper &mouseHelper, double &mouseFirstAx, double &mouseSecondAx,
                               double distanceFromDeadZone);
     void changeTurboParams(bool _isKeyPressed, bool isButtonPressed);
@@ -545,7 +556,7 @@ class JoyButton : public QObject
     QList<JoyButtonSlot *> &getAssignmentsLocal();
     QList<JoyButtonSlot *> &getActiveSlotsLocal(); // JoyButtonSlots class
     void updateMouseProperties(double newAxisValue, double newSpringDead, int newSpringWidth, int newSpringHeight,
-                               bool relatived, int modeScreen, QList<PadderCommon::springModeInfo> &springSpeeds, QChar axis,
+                               bool relatived, int modeScreen, JoyButton::SpringSpeeds &springSpeeds, QChar axis,
                                double newAxisValueY = 0, double newSpringDeadY = 0);
     // void getActiveZoneWithAppend(JoyButtonSlot::JoySlotInputAction mode, QList<JoyButtonSlot *>& tempSlotList,
     // QListIterator<JoyButtonSlot *> *iter, JoyButtonSlot *slot);
@@ -600,16 +611,20 @@ class JoyButton : public QObject
     double m_easingDuration;
     double extraAccelerationMultiplier;
 
-    QTimer pauseTimer;
-    QTimer holdTimer;
-    QTimer pauseWaitTimer;
-    QTimer createDeskTimer;
-    QTimer releaseDeskTimer;
-    QTimer setChangeTimer;
-    QTimer keyPressTimer;
-    QTimer delayTimer;
-    QTimer slotSetChangeTimer;
+    WheelTimer holdTimer;
+    WheelTimer pauseWaitTimer;
+    WheelTimer createDeskTimer;
+    WheelTimer releaseDeskTimer;
+    WheelTimer setChangeTimer;
+    WheelTimer keyPressTimer;
+    WheelTimer delayTimer;
+    WheelTimer slotSetChangeTimer;
     static QTimer staticMouseEventTimer; // JoyButtonEvents class
+#if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
+    static QRecursiveMutex sharedStateMutex;
+#else
+    static QMutex sharedStateMutex;
+#endif
 
     QString customName;
     QString actionName;
@@ -18,8 +18,10 @@
 #include "joycontrolstick.h"
 
 #include "globalvariables.h"
+#include "guitelemetry.h"
 #include "inputdevice.h"
 #include "joyaxis.h"
+#include "latencytracer.h"
 #include "joybuttontypes/joycontrolstickbutton.h"
 #include "joybuttontypes/joycontrolstickmodifierbutton.h"
 #include "xml/joybuttonxml.h"
@@ -39,6 +41,7 @@ const JoyControlStick::JoyMode JoyControlStick::DEFAULTMODE = JoyControlStick::S
 
 JoyControlStick::JoyControlStick(JoyAxis *axis1, JoyAxis *axis2, int index, int originset, QObject *parent)
     : QObject(parent)
+    , directionDelayTimer(this)
 {
     this->axisX = axis1;
     this->axisX->setControlStick(this);
@@ -71,6 +74,8 @@ JoyControlStick::~JoyControlStick()
  */
 void JoyControlStick::joyEvent(bool ignoresets)
 {
+    LatencyTracer::mark(LatencyTracer::JOY_EVENT);
+
     safezone = !inDeadZone();
 
     if (safezone && !isActive)
@@ -132,6 +137,7 @@ void JoyControlStick::joyEvent(bool ignoresets)
     }
 
     emit moved(axisX->getCurrentRawValue(), axisY->getCurrentRawValue());
+    GuiTelemetry::publishStick(this, axisX->getCurrentRawValue(), axisY->getCurrentRawValue());
 
     pendingStickEvent = false;
 }
@@ -2766,7 +2772,11 @@ double JoyControlStick::getCircleAdjust() { return circle; }
  * @brief Slot called when directionDelayTimer has timed out. The method will
  *     call createDeskEvent.
  */
-void JoyControlStick::stickDirectionChangeEvent() { createDeskEvent(); }
+void JoyControlStick::stickDirectionChangeEvent()
+{
+    QMutexLocker locker(getParentSet()->getInputDevice()->getInputMutex());
+    createDeskEvent();
+}
 
 void JoyControlStick::setStickDelay(int value)
 {
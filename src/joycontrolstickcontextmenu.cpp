@@ -186,7 +186,7 @@ void JoyControlStickContextMenu::setStickPreset(QAction *action)
     switch (item)
     {
     case 0: {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
@@ -196,12 +196,12 @@ void JoyControlStickContextMenu::setStickPreset(QAction *action)
         stick->setJoyMode(JoyControlStick::StandardMode);
         stick->setDiagonalRange(65);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         break;
     }
     case 1: {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
@@ -211,12 +211,12 @@ void JoyControlStickContextMenu::setStickPreset(QAction *action)
         stick->setJoyMode(JoyControlStick::StandardMode);
         stick->setDiagonalRange(65);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         break;
     }
     case 2: {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
@@ -226,12 +226,12 @@ void JoyControlStickContextMenu::setStickPreset(QAction *action)
         stick->setJoyMode(JoyControlStick::StandardMode);
         stick->setDiagonalRange(65);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         break;
     }
     case 3: {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseDown, JoyButtonSlot::JoyMouseMovement, this);
         downButtonSlot = new JoyButtonSlot(JoyButtonSlot::MouseUp, JoyButtonSlot::JoyMouseMovement, this);
@@ -241,12 +241,12 @@ void JoyControlStickContextMenu::setStickPreset(QAction *action)
         stick->setJoyMode(JoyControlStick::StandardMode);
         stick->setDiagonalRange(65);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         break;
     }
     case 4: {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(AntKeyMapper::getInstance()->returnVirtualKey(Qt::Key_Up), Qt::Key_Up,
                                          JoyButtonSlot::JoyKeyboard, this);
@@ -260,12 +260,12 @@ void JoyControlStickContextMenu::setStickPreset(QAction *action)
         stick->setJoyMode(JoyControlStick::StandardMode);
         stick->setDiagonalRange(45);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         break;
     }
     case 5: {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         upButtonSlot = new JoyButtonSlot(AntKeyMapper::getInstance()->returnVirtualKey(Qt::Key_W), Qt::Key_W,
                                          JoyButtonSlot::JoyKeyboard, this);
@@ -279,12 +279,12 @@ void JoyControlStickContextMenu::setStickPreset(QAction *action)
         stick->setJoyMode(JoyControlStick::StandardMode);
         stick->setDiagonalRange(45);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         break;
     }
     case 6: {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         if ((stick->getJoyMode() == JoyControlStick::StandardMode) ||
             (stick->getJoyMode() == JoyControlStick::FourWayCardinal))
@@ -336,7 +336,7 @@ void JoyControlStickContextMenu::setStickPreset(QAction *action)
 
         stick->setDiagonalRange(45);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
 
         break;
     }
@@ -366,7 +366,7 @@ int JoyControlStickContextMenu::getPresetIndex()
 {
     int result = 0;
 
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     JoyControlStickButton *upButton = stick->getDirectionButton(JoyControlStick::StickUp);
     QList<JoyButtonSlot *> *upslots = upButton->getAssignedSlots();
@@ -463,7 +463,7 @@ int JoyControlStickContextMenu::getPresetIndex()
         result = 8;
     }
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 
     return result;
 }
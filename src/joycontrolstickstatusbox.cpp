@@ -20,6 +20,7 @@
 
 #include "common.h"
 #include "globalvariables.h"
+#include "guitelemetry.h"
 #include "joyaxis.h"
 #include "joycontrolstick.h"
 
@@ -37,21 +38,34 @@ JoyControlStickStatusBox::JoyControlStickStatusBox(QWidget *parent)
     : QWidget(parent)
     , m_stick(nullptr)
 {
+    watchTelemetry();
 }
 
 JoyControlStickStatusBox::JoyControlStickStatusBox(JoyControlStick *stick, QWidget *parent)
     : QWidget(parent)
     , m_stick(nullptr)
 {
+    watchTelemetry();
     setStick(stick);
 }
 
+/**
+ * @brief Stick movement is taken from GuiTelemetry at display refresh rate.
+ */
+void JoyControlStickStatusBox::watchTelemetry()
+{
+    GuiTelemetry::getInstance()->watch(this);
+    connect(GuiTelemetry::getInstance(), &GuiTelemetry::stickMoved, this, [this](JoyControlStick *stick) {
+        if (stick == m_stick)
+            update();
+    });
+}
+
 void JoyControlStickStatusBox::setStick(JoyControlStick *stick)
 {
     if (m_stick != nullptr)
     {
         disconnect(stick, SIGNAL(deadZoneChanged(int)), this, nullptr);
-        disconnect(stick, SIGNAL(moved(int, int)), this, nullptr);
         disconnect(stick, SIGNAL(diagonalRangeChanged(int)), this, nullptr);
         disconnect(stick, SIGNAL(maxZoneChanged(int)), this, nullptr);
         disconnect(stick, SIGNAL(modifierZoneChanged(int)), this, nullptr);
@@ -61,7 +75,6 @@ void JoyControlStickStatusBox::setStick(JoyControlStick *stick)
 
     m_stick = stick;
     connect(stick, SIGNAL(deadZoneChanged(int)), this, SLOT(update()));
-    connect(stick, SIGNAL(moved(int, int)), this, SLOT(update()));
     connect(stick, SIGNAL(diagonalRangeChanged(int)), this, SLOT(update()));
     connect(stick, SIGNAL(maxZoneChanged(int)), this, SLOT(update()));
     connect(stick, SIGNAL(modifierZoneChanged(int)), this, SLOT(update()));
@@ -81,7 +94,7 @@ void JoyControlStickStatusBox::paintEvent(QPaintEvent *event)
 {
     Q_UNUSED(event);
 
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     if (m_stick == nullptr || m_stick->getJoyMode() == JoyControlStick::StandardMode ||
         m_stick->getJoyMode() == JoyControlStick::EightWayMode)
@@ -95,7 +108,7 @@ void JoyControlStickStatusBox::paintEvent(QPaintEvent *event)
         drawFourWayDiagonalBox();
     }
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 }
 
 void JoyControlStickStatusBox::drawEightWayBox()
@@ -47,6 +47,8 @@ class JoyControlStickStatusBox : public QWidget
     void drawFourWayDiagonalBox();
 
   private:
+    void watchTelemetry();
+
     JoyControlStick *m_stick;
 };
 
@@ -26,6 +26,7 @@
 
 JoyDPad::JoyDPad(int index, int originset, SetJoystick *parentSet, QObject *parent)
     : QObject(parent)
+    , directionDelayTimer(this)
 {
     m_index = index;
     buttons = QHash<int, JoyDPadButton *>();
@@ -863,7 +864,11 @@ void JoyDPad::createDeskEvent(bool ignoresets)
     }
 }
 
-void JoyDPad::dpadDirectionChangeEvent() { createDeskEvent(); }
+void JoyDPad::dpadDirectionChangeEvent()
+{
+    QMutexLocker locker(getParentSet()->getInputDevice()->getInputMutex());
+    createDeskEvent();
+}
 
 void JoyDPad::setDPadDelay(int value)
 {
@@ -18,13 +18,23 @@
 #define _USE_MATH_DEFINES
 
 #include "joygyroscopesensor.h"
+#include "event.h"
 #include "globalvariables.h"
+#include "guitelemetry.h"
+#include "joyaccelerometersensor.h"
 #include "joybuttontypes/joygyroscopebutton.h"
+#include "mouseoutputthread.h"
+#include "setjoystick.h"
 
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
 #include <cmath>
 
-JoyGyroscopeSensor::JoyGyroscopeSensor(int originset, SetJoystick *parent_set, QObject *parent)
+JoyGyroscopeSensor::JoyGyroscopeSensor(double rate, int originset, SetJoystick *parent_set, QObject *parent)
     : JoySensor(GYROSCOPE, originset, parent_set, parent)
+    , m_rate(qFuzzyIsNull(rate) ? PT1Filter::FALLBACK_RATE : rate)
+    , m_gyro_mouse_enabled(false)
+    , m_gyro_mouse(m_rate)
 {
     reset();
     populateButtons();
@@ -32,6 +42,77 @@ JoyGyroscopeSensor::JoyGyroscopeSensor(int originset, SetJoystick *parent_set, Q
 
 JoyGyroscopeSensor::~JoyGyroscopeSensor() {}
 
+/**
+ * @brief Moves the cursor by the rotation integrated since the last event
+ *  when gyro mouse mode is enabled and runs the regular sensor mapping
+ *  otherwise. The direction buttons are bypassed in gyro mouse mode,
+ *  buttons which are still active from before are released.
+ */
+void JoyGyroscopeSensor::joyEvent(float *values, bool ignoresets)
+{
+    if (!m_gyro_mouse_enabled)
+    {
+        JoySensor::joyEvent(values, ignoresets);
+        return;
+    }
+
+    m_current_value[0] = values[0];
+    m_current_value[1] = values[1];
+    m_current_value[2] = values[2];
+
+    if (m_active)
+    {
+        m_active = false;
+        if (m_delay_timer.isActive())
+            m_delay_timer.stop();
+
+        emit released(m_current_value[0], m_current_value[1], m_current_value[2]);
+        createDeskEvent(SENSOR_CENTERED, ignoresets);
+    }
+
+    int dx = 0;
+    int dy = 0;
+
+    if (ignoresets)
+        m_gyro_mouse.reset();
+    else if (m_gyro_mouse.takeDelta(&dx, &dy))
+    {
+        // The mouse output thread is fed by the mouse helper as well and
+        // output of other devices may be written at the same time.
+        JoyButton::lockSharedState();
+
+        if (!MouseOutputThread::submit(dx, dy, GlobalVariables::JoyButton::gamepadRefreshRate))
+            sendevent(dx, dy);
+
+        JoyButton::unlockSharedState();
+    }
+
+    emit moved(m_current_value[0], m_current_value[1], m_current_value[2]);
+    GuiTelemetry::publishSensor(this, m_current_value[0], m_current_value[1], m_current_value[2]);
+}
+
+/**
+ * @brief Queues next movement event from InputDaemon.
+ *  In gyro mouse mode every sample is integrated here because
+ *  only the latest one is kept until the event is activated.
+ * @param[in] timestampUs Sensor timestamp in µs, 0 if unknown
+ */
+void JoyGyroscopeSensor::queuePendingEvent(float *values, bool ignoresets, quint64 timestampUs)
+{
+    JoySensor::queuePendingEvent(values, ignoresets, timestampUs);
+
+    if (m_gyro_mouse_enabled)
+    {
+        double gravity[3] = {0, 0, 0};
+        JoySensor *accelerometer = getParentSet()->getSensor(ACCELEROMETER);
+
+        if (accelerometer != nullptr)
+            static_cast<JoyAccelerometerSensor *>(accelerometer)->getGravity(&gravity[0], &gravity[1], &gravity[2]);
+
+        m_gyro_mouse.processSample(m_pending_value, gravity, m_max_zone, timestampUs);
+    }
+}
+
 /**
  * @brief Get the value for the corresponding X axis.
  * @return X axis value in °/s
@@ -90,6 +171,169 @@ void JoyGyroscopeSensor::reset()
 {
     JoySensor::reset();
     m_max_zone = degToRad(GlobalVariables::JoySensor::GYRO_MAX);
+
+    m_gyro_mouse_enabled = false;
+    m_gyro_mouse = GyroMouse(m_rate);
+}
+
+/**
+ * @brief Checks if the gyroscope moves the cursor directly
+ */
+bool JoyGyroscopeSensor::isGyroMouseEnabled() const { return m_gyro_mouse_enabled; }
+
+/**
+ * @brief Get the gyro mouse sensitivity
+ * @returns Sensitivity in pixels per degree
+ */
+double JoyGyroscopeSensor::getGyroMouseSensitivity() const { return m_gyro_mouse.getSensitivity(); }
+
+/**
+ * @brief Get the curve applied to the angular velocity in gyro mouse mode
+ */
+GyroMouse::Curve JoyGyroscopeSensor::getGyroMouseCurve() const { return m_gyro_mouse.getCurve(); }
+
+/**
+ * @brief Get the space in which yaw and pitch are taken in gyro mouse mode
+ */
+GyroMouse::Space JoyGyroscopeSensor::getGyroMouseSpace() const { return m_gyro_mouse.getSpace(); }
+
+/**
+ * @brief Get the gyro mouse smoothing
+ * @returns Smoothing time constant in ms
+ */
+double JoyGyroscopeSensor::getGyroMouseSmoothing() const { return m_gyro_mouse.getSmoothing(); }
+
+/**
+ * @brief Enables or disables gyro mouse mode
+ * @param[in] enabled True to move the cursor directly, false to use the direction buttons
+ */
+void JoyGyroscopeSensor::setGyroMouseEnabled(bool enabled)
+{
+    if (enabled != m_gyro_mouse_enabled)
+    {
+        m_gyro_mouse.reset();
+        m_gyro_mouse_enabled = enabled;
+        emit propertyUpdated();
+    }
+}
+
+/**
+ * @brief Sets the gyro mouse sensitivity
+ * @param[in] value Sensitivity in pixels per degree
+ */
+void JoyGyroscopeSensor::setGyroMouseSensitivity(double value)
+{
+    if ((value > 0) && !qFuzzyCompare(value, m_gyro_mouse.getSensitivity()))
+    {
+        m_gyro_mouse.setSensitivity(value);
+        emit propertyUpdated();
+    }
+}
+
+/**
+ * @brief Sets the curve applied to the angular velocity in gyro mouse mode
+ */
+void JoyGyroscopeSensor::setGyroMouseCurve(GyroMouse::Curve curve)
+{
+    if (curve != m_gyro_mouse.getCurve())
+    {
+        m_gyro_mouse.setCurve(curve);
+        emit propertyUpdated();
+    }
+}
+
+/**
+ * @brief Sets the space in which yaw and pitch are taken in gyro mouse mode
+ */
+void JoyGyroscopeSensor::setGyroMouseSpace(GyroMouse::Space space)
+{
+    if (space != m_gyro_mouse.getSpace())
+    {
+        m_gyro_mouse.setSpace(space);
+        emit propertyUpdated();
+    }
+}
+
+/**
+ * @brief Sets the gyro mouse smoothing
+ * @param[in] value Smoothing time constant in ms, 0 disables smoothing
+ */
+void JoyGyroscopeSensor::setGyroMouseSmoothing(double value)
+{
+    if ((value >= 0) && !qFuzzyCompare(value + 1, m_gyro_mouse.getSmoothing() + 1))
+    {
+        m_gyro_mouse.setSmoothing(value);
+        emit propertyUpdated();
+    }
+}
+
+bool JoyGyroscopeSensor::isTypeDefault() const
+{
+    return !m_gyro_mouse_enabled &&
+           qFuzzyCompare(m_gyro_mouse.getSensitivity(), GlobalVariables::JoySensor::DEFAULTGYROMOUSESENSITIVITY) &&
+           (m_gyro_mouse.getCurve() == GyroMouse::DEFAULTCURVE) && (m_gyro_mouse.getSpace() == GyroMouse::DEFAULTSPACE) &&
+           qFuzzyCompare(m_gyro_mouse.getSmoothing() + 1, GlobalVariables::JoySensor::DEFAULTGYROMOUSESMOOTHING + 1);
+}
+
+void JoyGyroscopeSensor::copyTypeAssignments(JoySensor *dest_sensor) const
+{
+    if (dest_sensor->getType() != GYROSCOPE)
+        return;
+
+    JoyGyroscopeSensor *dest = static_cast<JoyGyroscopeSensor *>(dest_sensor);
+    dest->m_gyro_mouse_enabled = m_gyro_mouse_enabled;
+    dest->m_gyro_mouse.setSensitivity(m_gyro_mouse.getSensitivity());
+    dest->m_gyro_mouse.setCurve(m_gyro_mouse.getCurve());
+    dest->m_gyro_mouse.setSpace(m_gyro_mouse.getSpace());
+    dest->m_gyro_mouse.setSmoothing(m_gyro_mouse.getSmoothing());
+}
+
+bool JoyGyroscopeSensor::readTypeConfig(QXmlStreamReader *xml)
+{
+    if (xml->name().toString() == "gyroMouse")
+    {
+        QString temptext = xml->readElementText();
+        setGyroMouseEnabled(temptext == "true");
+    } else if (xml->name().toString() == "gyroMouseSensitivity")
+    {
+        QString temptext = xml->readElementText();
+        setGyroMouseSensitivity(temptext.toDouble());
+    } else if (xml->name().toString() == "gyroMouseCurve")
+    {
+        QString temptext = xml->readElementText();
+        setGyroMouseCurve(GyroMouse::curveFromName(temptext));
+    } else if (xml->name().toString() == "gyroMouseSpace")
+    {
+        QString temptext = xml->readElementText();
+        setGyroMouseSpace(GyroMouse::spaceFromName(temptext));
+    } else if (xml->name().toString() == "gyroMouseSmoothing")
+    {
+        QString temptext = xml->readElementText();
+        setGyroMouseSmoothing(temptext.toDouble());
+    } else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+void JoyGyroscopeSensor::writeTypeConfig(QXmlStreamWriter *xml) const
+{
+    if (m_gyro_mouse_enabled)
+        xml->writeTextElement("gyroMouse", "true");
+
+    if (!qFuzzyCompare(m_gyro_mouse.getSensitivity(), GlobalVariables::JoySensor::DEFAULTGYROMOUSESENSITIVITY))
+        xml->writeTextElement("gyroMouseSensitivity", QString::number(m_gyro_mouse.getSensitivity()));
+
+    if (m_gyro_mouse.getCurve() != GyroMouse::DEFAULTCURVE)
+        xml->writeTextElement("gyroMouseCurve", GyroMouse::curveName(m_gyro_mouse.getCurve()));
+
+    if (m_gyro_mouse.getSpace() != GyroMouse::DEFAULTSPACE)
+        xml->writeTextElement("gyroMouseSpace", GyroMouse::spaceName(m_gyro_mouse.getSpace()));
+
+    if (!qFuzzyCompare(m_gyro_mouse.getSmoothing() + 1, GlobalVariables::JoySensor::DEFAULTGYROMOUSESMOOTHING + 1))
+        xml->writeTextElement("gyroMouseSmoothing", QString::number(m_gyro_mouse.getSmoothing()));
 }
 
 /**
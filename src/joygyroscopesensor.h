@@ -17,19 +17,25 @@
 
 #pragma once
 
+#include "gyromouse.h"
 #include "joysensor.h"
 
 class SetJoystick;
 
 /**
  * @brief Represents a gyroscope sensor.
+ *  In gyro mouse mode the angular velocity moves the cursor directly
+ *  and the direction buttons are not used.
  */
 class JoyGyroscopeSensor : public JoySensor
 {
   public:
-    explicit JoyGyroscopeSensor(int originset, SetJoystick *parent_set, QObject *parent);
+    explicit JoyGyroscopeSensor(double rate, int originset, SetJoystick *parent_set, QObject *parent);
     virtual ~JoyGyroscopeSensor();
 
+    virtual void joyEvent(float *values, bool ignoresets = false) override;
+    virtual void queuePendingEvent(float *values, bool ignoresets = false, quint64 timestampUs = 0) override;
+
     virtual float getXCoordinate() const override;
     virtual float getYCoordinate() const override;
     virtual float getZCoordinate() const override;
@@ -38,6 +44,18 @@ class JoyGyroscopeSensor : public JoySensor
     virtual void getCalibration(double *offsetX, double *offsetY, double *offsetZ) const override;
     virtual void setCalibration(double offsetX, double offsetY, double offsetZ) override;
 
+    bool isGyroMouseEnabled() const;
+    double getGyroMouseSensitivity() const;
+    GyroMouse::Curve getGyroMouseCurve() const;
+    GyroMouse::Space getGyroMouseSpace() const;
+    double getGyroMouseSmoothing() const;
+
+    void setGyroMouseEnabled(bool enabled);
+    void setGyroMouseSensitivity(double value);
+    void setGyroMouseCurve(GyroMouse::Curve curve);
+    void setGyroMouseSpace(GyroMouse::Space space);
+    void setGyroMouseSmoothing(double value);
+
   public slots:
     virtual void reset() override;
 
@@ -45,4 +63,13 @@ class JoyGyroscopeSensor : public JoySensor
     virtual void populateButtons();
     virtual JoySensorDirection calculateSensorDirection() override;
     virtual void applyCalibration() override;
+
+    virtual bool isTypeDefault() const override;
+    virtual void copyTypeAssignments(JoySensor *dest_sensor) const override;
+    virtual bool readTypeConfig(QXmlStreamReader *xml) override;
+    virtual void writeTypeConfig(QXmlStreamWriter *xml) const override;
+
+    double m_rate;
+    bool m_gyro_mouse_enabled;
+    GyroMouse m_gyro_mouse;
 };
@@ -18,6 +18,7 @@
 #define _USE_MATH_DEFINES
 
 #include "joysensor.h"
+#include "guitelemetry.h"
 #include "inputdevice.h"
 #include "joybuttontypes/joysensorbutton.h"
 #include "xml/joybuttonxml.h"
@@ -32,6 +33,7 @@ JoySensor::JoySensor(JoySensorType type, int originset, SetJoystick *parent_set,
     , m_calibrated(false)
     , m_pending_event(false)
     , m_originset(originset)
+    , m_delay_timer(this)
     , m_parent_set(parent_set)
 {
     reset();
@@ -113,13 +115,17 @@ void JoySensor::joyEvent(float *values, bool ignoresets)
     }
 
     emit moved(m_current_value[0], m_current_value[1], m_current_value[2]);
+    GuiTelemetry::publishSensor(this, m_current_value[0], m_current_value[1], m_current_value[2]);
 }
 
 /**
  * @brief Queues next movement event from InputDaemon
+ * @param[in] timestampUs Sensor timestamp in µs, 0 if unknown
  */
-void JoySensor::queuePendingEvent(float *values, bool ignoresets)
+void JoySensor::queuePendingEvent(float *values, bool ignoresets, quint64 timestampUs)
 {
+    Q_UNUSED(timestampUs)
+
     m_pending_value[0] = values[0];
     m_pending_value[1] = values[1];
     m_pending_value[2] = values[2];
@@ -191,6 +197,8 @@ void JoySensor::copyAssignments(JoySensor *dest_sensor)
         }
     }
 
+    copyTypeAssignments(dest_sensor);
+
     if (!dest_sensor->isDefault())
         emit propertyUpdated();
 }
@@ -566,6 +574,8 @@ bool JoySensor::isDefault() const
     value = value && qFuzzyCompare(getDiagonalRange(), GlobalVariables::JoySensor::DEFAULTDIAGONALRANGE);
     value = value && (m_sensor_delay == GlobalVariables::JoySensor::DEFAULTSENSORDELAY);
 
+    value = value && isTypeDefault();
+
     for (const auto &button : m_buttons)
         value = value && (button->isDefault());
 
@@ -720,7 +730,7 @@ void JoySensor::readConfig(QXmlStreamReader *xml)
                 QString temptext = xml->readElementText();
                 int tempchoice = temptext.toInt();
                 setSensorDelay(tempchoice);
-            } else
+            } else if (!(xml->isStartElement() && readTypeConfig(xml)))
             {
                 xml->skipCurrentElement();
             }
@@ -755,6 +765,8 @@ void JoySensor::writeConfig(QXmlStreamWriter *xml) const
         if (m_sensor_delay > GlobalVariables::JoySensor::DEFAULTSENSORDELAY)
             xml->writeTextElement("sensorDelay", QString::number(m_sensor_delay));
 
+        writeTypeConfig(xml);
+
         for (const auto &button : m_buttons)
         {
             JoyButtonXml *joyButtonXml = new JoyButtonXml(button);
@@ -777,7 +789,38 @@ SetJoystick *JoySensor::getParentSet() const { return m_parent_set; }
  * @brief Slot called when m_delay_timer has timed out. The method will
  *     call createDeskEvent.
  */
-void JoySensor::delayTimerExpired() { createDeskEvent(calculateSensorDirection()); }
+void JoySensor::delayTimerExpired()
+{
+    QMutexLocker locker(m_parent_set->getInputDevice()->getInputMutex());
+    createDeskEvent(calculateSensorDirection());
+}
+
+/**
+ * @brief Checks if the properties of the derived sensor type are at their
+ *  default values. Sensors without such properties are always default.
+ */
+bool JoySensor::isTypeDefault() const { return true; }
+
+/**
+ * @brief Copies the properties of the derived sensor type onto another sensor
+ *  of the same type.
+ */
+void JoySensor::copyTypeAssignments(JoySensor *dest_sensor) const { Q_UNUSED(dest_sensor); }
+
+/**
+ * @brief Reads a property element of the derived sensor type.
+ * @return true if the element was consumed, false if it is unknown
+ */
+bool JoySensor::readTypeConfig(QXmlStreamReader *xml)
+{
+    Q_UNUSED(xml);
+    return false;
+}
+
+/**
+ * @brief Writes the non-default properties of the derived sensor type.
+ */
+void JoySensor::writeTypeConfig(QXmlStreamWriter *xml) const { Q_UNUSED(xml); }
 
 /**
  * @brief Reset all the properties of the sensor direction buttons.
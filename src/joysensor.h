@@ -44,8 +44,8 @@ class JoySensor : public QObject
     explicit JoySensor(JoySensorType type, int originset, SetJoystick *parent_set, QObject *parent);
     virtual ~JoySensor();
 
-    void joyEvent(float *values, bool ignoresets = false);
-    void queuePendingEvent(float *values, bool ignoresets = false);
+    virtual void joyEvent(float *values, bool ignoresets = false);
+    virtual void queuePendingEvent(float *values, bool ignoresets = false, quint64 timestampUs = 0);
     void activatePendingEvent();
     bool hasPendingEvent() const;
     void clearPendingEvent();
@@ -132,6 +132,11 @@ class JoySensor : public QObject
     void determineSensorEvent(JoySensorButton **eventbutton) const;
     void createDeskEvent(JoySensorDirection direction, bool ignoresets = false);
 
+    virtual bool isTypeDefault() const;
+    virtual void copyTypeAssignments(JoySensor *dest_sensor) const;
+    virtual bool readTypeConfig(QXmlStreamReader *xml);
+    virtual void writeTypeConfig(QXmlStreamWriter *xml) const;
+
     JoySensorType m_type;
     double m_dead_zone;
     double m_diagonal_range;
@@ -26,7 +26,7 @@ JoySensor *build(JoySensorType type, double rate, int originset, SetJoystick *pa
     if (type == ACCELEROMETER)
         return new JoyAccelerometerSensor(rate, originset, parent_set, parent);
     else if (type == GYROSCOPE)
-        return new JoyGyroscopeSensor(originset, parent_set, parent);
+        return new JoyGyroscopeSensor(rate, originset, parent_set, parent);
     else
         return nullptr;
 }
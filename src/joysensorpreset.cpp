@@ -65,7 +65,7 @@ JoySensorPreset::Preset JoySensorPreset::currentPreset()
     QList<JoyButtonSlot *> *leftslots, *rightslots, *upslots, *downslots, *fwdslots, *bwdslots;
     JoySensorButton *leftButton, *rightButton, *upButton, *downButton, *fwdButton, *bwdButton;
 
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
 
     if (m_sensor->getType() == GYROSCOPE)
     {
@@ -201,7 +201,7 @@ JoySensorPreset::Preset JoySensorPreset::currentPreset()
         }
     }
 
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
     return result;
 }
 
@@ -19,6 +19,7 @@
 
 #include "common.h"
 #include "globalvariables.h"
+#include "guitelemetry.h"
 #include "joyaxis.h"
 #include "joysensor.h"
 
@@ -36,6 +37,12 @@ JoySensorStatusBox::JoySensorStatusBox(QWidget *parent)
     : QWidget(parent)
     , m_sensor(nullptr)
 {
+    // Sensor movement is taken from GuiTelemetry at display refresh rate.
+    GuiTelemetry::getInstance()->watch(this);
+    connect(GuiTelemetry::getInstance(), &GuiTelemetry::sensorMoved, this, [this](JoySensor *sensor) {
+        if (sensor == m_sensor)
+            update();
+    });
 }
 
 /**
@@ -49,14 +56,12 @@ void JoySensorStatusBox::setSensor(JoySensor *sensor)
     if (m_sensor != nullptr)
     {
         disconnect(m_sensor, SIGNAL(deadZoneChanged(double)), this, nullptr);
-        disconnect(m_sensor, SIGNAL(moved(float, float, float)), this, nullptr);
         disconnect(m_sensor, SIGNAL(diagonalRangeChanged(double)), this, nullptr);
         disconnect(m_sensor, SIGNAL(maxZoneChanged(double)), this, nullptr);
     }
 
     m_sensor = sensor;
     connect(m_sensor, SIGNAL(deadZoneChanged(double)), this, SLOT(update()));
-    connect(m_sensor, SIGNAL(moved(float, float, float)), this, SLOT(update()));
     connect(m_sensor, SIGNAL(diagonalRangeChanged(double)), this, SLOT(update()));
     connect(m_sensor, SIGNAL(maxZoneChanged(double)), this, SLOT(update()));
 
@@ -74,9 +79,9 @@ void JoySensorStatusBox::paintEvent(QPaintEvent *event)
 {
     Q_UNUSED(event);
 
-    PadderCommon::inputDaemonMutex.lock();
+    PadderCommon::inputDaemonLock.lockForWrite();
     drawArtificialHorizon();
-    PadderCommon::inputDaemonMutex.unlock();
+    PadderCommon::inputDaemonLock.unlock();
 }
 
 /**
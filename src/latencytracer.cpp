@@ -0,0 +1,240 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "latencytracer.h"
+
+#include <SDL2/SDL_timer.h>
+
+#include <QStringList>
+
+#include <array>
+#include <chrono>
+
+namespace {
+
+/**
+ * @brief Histogram of latencies in microseconds. Values below 16 us get
+ *  their own bucket, larger ones are split into 8 buckets per power of two,
+ *  which keeps the reported percentiles within 12.5% of the real value.
+ */
+class LatencyHistogram
+{
+  public:
+    LatencyHistogram() { reset(); }
+
+    void record(quint64 value)
+    {
+        m_buckets[bucketIndex(value)]++;
+        m_count++;
+        m_max = qMax(m_max, value);
+    }
+
+    void reset()
+    {
+        m_buckets.fill(0);
+        m_count = 0;
+        m_max = 0;
+    }
+
+    /**
+     * @brief Upper bound of the bucket containing the given percentile.
+     */
+    quint64 percentile(double fraction) const
+    {
+        if (m_count == 0)
+            return 0;
+
+        quint64 target = qMax<quint64>(1, static_cast<quint64>(fraction * m_count + 0.5));
+        quint64 cumulative = 0;
+
+        for (int i = 0; i < BUCKET_COUNT; i++)
+        {
+            cumulative += m_buckets[i];
+
+            if (cumulative >= target)
+                return qMin(bucketUpperBound(i), m_max);
+        }
+
+        return m_max;
+    }
+
+    quint64 count() const { return m_count; }
+    quint64 max() const { return m_max; }
+
+  private:
+    static const int LINEAR_BUCKETS = 16;
+    static const int SUB_BUCKET_BITS = 3;
+    static const int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static const int BUCKET_COUNT = LINEAR_BUCKETS + (64 - 4) * SUB_BUCKETS;
+
+    static int highestBit(quint64 value)
+    {
+        int bit = 0;
+
+        while (value >>= 1)
+            bit++;
+
+        return bit;
+    }
+
+    static int bucketIndex(quint64 value)
+    {
+        if (value < LINEAR_BUCKETS)
+            return static_cast<int>(value);
+
+        int exponent = highestBit(value);
+        int sub = static_cast<int>((value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+
+        return LINEAR_BUCKETS + (exponent - 4) * SUB_BUCKETS + sub;
+    }
+
+    static quint64 bucketUpperBound(int index)
+    {
+        if (index < LINEAR_BUCKETS)
+            return static_cast<quint64>(index);
+
+        int exponent = (index - LINEAR_BUCKETS) / SUB_BUCKETS + 4;
+        quint64 sub = static_cast<quint64>((index - LINEAR_BUCKETS) % SUB_BUCKETS);
+        quint64 step = Q_UINT64_C(1) << (exponent - SUB_BUCKET_BITS);
+
+        return (Q_UINT64_C(1) << exponent) + (sub + 1) * step - 1;
+    }
+
+    std::array<quint64, BUCKET_COUNT> m_buckets;
+    quint64 m_count;
+    quint64 m_max;
+};
+
+struct TraceState
+{
+    std::array<LatencyHistogram, LatencyTracer::STAGE_COUNT> histograms;
+    std::chrono::steady_clock::time_point start;
+    quint64 queueLatency = 0;
+    unsigned int markedStages = 0;
+};
+
+TraceState &traceState()
+{
+    static TraceState state;
+    return state;
+}
+
+const char *stageName(int stage)
+{
+    switch (stage)
+    {
+    case LatencyTracer::SDL_QUEUE:
+        return "sdl queue";
+    case LatencyTracer::JOY_EVENT:
+        return "joyEvent";
+    case LatencyTracer::SLOT_ACTIVATION:
+        return "activateSlots";
+    case LatencyTracer::OUTPUT:
+        return "output";
+    case LatencyTracer::END_TO_END:
+        return "end-to-end";
+    default:
+        return "unknown";
+    }
+}
+
+} // namespace
+
+bool LatencyTracer::m_enabled = false;
+thread_local bool LatencyTracer::m_tracing = false;
+
+/**
+ * @brief Must be called before the input thread is started.
+ */
+void LatencyTracer::setEnabled(bool enabled) { m_enabled = enabled; }
+
+/**
+ * @brief Starts tracing an SDL event which is about to be dispatched.
+ * @param SDL timestamp of the event in milliseconds.
+ */
+void LatencyTracer::beginEvent(quint32 sdlTimestamp)
+{
+    if (!m_enabled)
+        return;
+
+    TraceState &state = traceState();
+    quint32 now = SDL_GetTicks();
+
+    // SDL timestamps only have millisecond resolution
+    state.queueLatency = (now >= sdlTimestamp) ? (now - sdlTimestamp) * Q_UINT64_C(1000) : 0;
+    state.histograms[SDL_QUEUE].record(state.queueLatency);
+    state.start = std::chrono::steady_clock::now();
+    state.markedStages = 0;
+    m_tracing = true;
+}
+
+void LatencyTracer::endEvent() { m_tracing = false; }
+
+/**
+ * @brief Records the time since the start of the current trace. Only the
+ *  first mark of every stage is counted per event.
+ */
+void LatencyTracer::markStage(Stage stage)
+{
+    TraceState &state = traceState();
+    unsigned int stageBit = 1U << stage;
+
+    if ((state.markedStages & stageBit) != 0)
+        return;
+
+    state.markedStages |= stageBit;
+
+    quint64 elapsed = static_cast<quint64>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - state.start).count());
+    state.histograms[stage].record(elapsed);
+
+    if (stage == OUTPUT)
+        state.histograms[END_TO_END].record(state.queueLatency + elapsed);
+}
+
+/**
+ * @brief Must be called from the thread which runs traces.
+ */
+void LatencyTracer::reset()
+{
+    for (LatencyHistogram &histogram : traceState().histograms)
+        histogram.reset();
+}
+
+/**
+ * @brief Per-stage summary of collected latencies in microseconds.
+ *  Must be called from the thread which runs traces.
+ */
+QString LatencyTracer::getReport()
+{
+    QStringList lines;
+    lines.append("Input latency trace (us):");
+
+    for (int i = 0; i < STAGE_COUNT; i++)
+    {
+        const LatencyHistogram &histogram = traceState().histograms[i];
+
+        lines.append(QString("  %1: count %2, p50 %3, p99 %4, max %5")
+                         .arg(stageName(i), -14)
+                         .arg(histogram.count())
+                         .arg(histogram.percentile(0.50))
+                         .arg(histogram.percentile(0.99))
+                         .arg(histogram.max()));
+    }
+
+    return lines.join("\n");
+}
@@ -0,0 +1,64 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QString>
+#include <QtGlobal>
+
+/**
+ * @brief Measures how long a single SDL event takes to travel through the
+ *  input pipeline and collects per-stage latency histograms.
+ *  A trace is started by InputDaemon for every dispatched SDL event and
+ *  ended once the event and its pending device events were processed.
+ *  Stages marked outside of a running trace (timers, other threads) are
+ *  ignored, so only work caused directly by the event is counted.
+ *  Tracing is disabled by default and enabled with --latency-trace.
+ */
+class LatencyTracer
+{
+  public:
+    enum Stage
+    {
+        SDL_QUEUE = 0,   ///< SDL event timestamp to dispatch in InputDaemon (ms resolution)
+        JOY_EVENT,       ///< dispatch to first JoyButton/JoyControlStick joyEvent
+        SLOT_ACTIVATION, ///< dispatch to first JoyButton::activateSlots
+        OUTPUT,          ///< dispatch to first event written by the event handler
+        END_TO_END,      ///< SDL event timestamp to first written event
+        STAGE_COUNT
+    };
+
+    static void setEnabled(bool enabled);
+    inline static bool isEnabled() { return m_enabled; }
+
+    static void beginEvent(quint32 sdlTimestamp);
+    static void endEvent();
+    inline static void mark(Stage stage)
+    {
+        if (m_tracing)
+            markStage(stage);
+    }
+
+    static void reset();
+    static QString getReport();
+
+  private:
+    static void markStage(Stage stage);
+
+    static bool m_enabled;
+    static thread_local bool m_tracing;
+};
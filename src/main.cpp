@@ -27,13 +27,16 @@
 #include "joybuttonslot.h"
 #include "joysensordirection.h"
 #include "joysensortype.h"
+#include "latencytracer.h"
 #include "localantimicroserver.h"
 #include "mainwindow.h"
+#include "mouseoutputthread.h"
 #include "setjoystick.h"
 #include "simplekeygrabberbutton.h"
 
 #include "eventhandlerfactory.h"
 #include "logger.h"
+#include "xmlconfigwriter.h"
 
 #include <QApplication>
 #include <QDebug>
@@ -269,6 +272,7 @@ int main(int argc, char *argv[])
     }
     settings.importFromCommandLine(cmdutility);
     settings.applySettingsToLogger(cmdutility, appLogger);
+    LatencyTracer::setEnabled(cmdutility.isLatencyTraceEnabled());
 
     Q_INIT_RESOURCE(resources);
 
@@ -598,6 +602,14 @@ int main(int argc, char *argv[])
 
     joypad_worker->moveToThread(inputEventThread);
     PadderCommon::mouseHelperObj.moveToThread(inputEventThread);
+
+    if (!cmdutility.getRecordFile().isEmpty())
+        QMetaObject::invokeMethod(joypad_worker.data(), "startRecording", Qt::QueuedConnection,
+                                  Q_ARG(QString, cmdutility.getRecordFile()));
+
+    if (!cmdutility.getReplayFile().isEmpty())
+        QMetaObject::invokeMethod(joypad_worker.data(), "startReplay", Qt::QueuedConnection,
+                                  Q_ARG(QString, cmdutility.getReplayFile()));
     inputEventThread->start(QThread::HighPriority);
 
     int app_result = antimicrox.exec();
@@ -607,6 +619,9 @@ int main(int argc, char *argv[])
     delete localServer;
     localServer = nullptr;
 
+    // Scheduled saves are serialized in the threads of the devices.
+    XMLConfigWriter::waitForPendingWrites();
+
     if (!joypad_worker.isNull())
     {
         joypad_worker->deleteLater();
@@ -618,6 +633,8 @@ int main(int argc, char *argv[])
     delete inputEventThread;
     inputEventThread = nullptr;
 
+    MouseOutputThread::shutdown();
+
     delete joysticks;
     joysticks = nullptr;
 
@@ -358,12 +358,12 @@ void MouseAxisSettingsDialog::updateExtraAccelerationCurve(int index)
 
     if (index > 0)
     {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         axis->getPAxisButton()->setExtraAccelerationCurve(temp);
         axis->getNAxisButton()->setExtraAccelerationCurve(temp);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
     }
 }
 
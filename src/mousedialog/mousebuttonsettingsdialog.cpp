@@ -278,12 +278,12 @@ void MouseButtonSettingsDialog::updateExtraAccelerationCurve(int index)
 
     if (index > 0)
     {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
 
         button->setExtraAccelerationCurve(temp);
         button->setExtraAccelerationCurve(temp);
 
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
     }
 }
 
@@ -356,9 +356,9 @@ void MouseControlStickSettingsDialog::updateExtraAccelerationCurve(int index)
     JoyButton::JoyExtraAccelerationCurve temp = getExtraAccelCurveForIndex(index);
     if (index > 0)
     {
-        PadderCommon::inputDaemonMutex.lock();
+        PadderCommon::inputDaemonLock.lockForWrite();
         stick->setButtonsExtraAccelCurve(temp);
-        PadderCommon::inputDaemonMutex.unlock();
+        PadderCommon::inputDaemonLock.unlock();
     }
 }
 
@@ -0,0 +1,139 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mousehistory.h"
+
+#include <algorithm>
+#include <cmath>
+
+const int MouseHistory::CAPACITY;
+
+MouseHistory::MouseHistory()
+    : m_newest(CAPACITY - 1)
+    , m_count(0)
+    , m_size(1)
+    , m_pushes_since_recompute(0)
+    , m_weight_modifier(0.0)
+    , m_oldest_weight(1.0)
+    , m_sum(0.0)
+    , m_weight_total(0.0)
+{
+    std::fill(m_values, m_values + CAPACITY, 0.0);
+}
+
+/**
+ * @brief Changes the number of values taken into account and clears the
+ *  history. Sizes outside of 1 - CAPACITY are ignored.
+ */
+void MouseHistory::setSize(int size)
+{
+    if ((size < 1) || (size > CAPACITY))
+        return;
+
+    m_size = size;
+    m_oldest_weight = std::pow(m_weight_modifier, m_size - 1);
+    clear();
+}
+
+/**
+ * @brief Adds the newest value. The oldest one drops out once the history
+ *  holds size() values.
+ */
+void MouseHistory::push(double value, double weightModifier)
+{
+    if (weightModifier != m_weight_modifier)
+        setWeightModifier(weightModifier);
+
+    if (m_count == m_size)
+    {
+        m_sum = value + m_weight_modifier * (m_sum - at(m_size - 1) * m_oldest_weight);
+    } else
+    {
+        m_sum = value + m_weight_modifier * m_sum;
+        m_weight_total = 1.0 + m_weight_modifier * m_weight_total;
+        m_count++;
+    }
+
+    m_newest = (m_newest + 1) % CAPACITY;
+    m_values[m_newest] = value;
+
+    if (++m_pushes_since_recompute >= CAPACITY)
+        recomputeSum();
+}
+
+void MouseHistory::clear()
+{
+    m_count = 0;
+    m_sum = 0.0;
+    m_weight_total = 0.0;
+    m_pushes_since_recompute = 0;
+}
+
+/**
+ * @brief Fills the whole history with zeros, e.g. when the cursor stops.
+ */
+void MouseHistory::fillWithZeros(double weightModifier)
+{
+    if (weightModifier != m_weight_modifier)
+        setWeightModifier(weightModifier);
+
+    std::fill(m_values, m_values + CAPACITY, 0.0);
+    m_count = m_size;
+    m_sum = 0.0;
+    m_pushes_since_recompute = 0;
+    recomputeSum();
+}
+
+/**
+ * @brief Weighted average of all values, 0 for an empty history or when
+ *  only rounding noise of the incremental update is left.
+ */
+double MouseHistory::weightedAverage() const
+{
+    if ((m_count == 0) || (std::fabs(m_sum) < 1e-9))
+        return 0.0;
+
+    return m_sum / m_weight_total;
+}
+
+/**
+ * @brief Value at the given age, 0 being the newest value.
+ */
+double MouseHistory::at(int index) const { return m_values[(m_newest - index + CAPACITY) % CAPACITY]; }
+
+void MouseHistory::setWeightModifier(double weightModifier)
+{
+    m_weight_modifier = weightModifier;
+    m_oldest_weight = std::pow(m_weight_modifier, m_size - 1);
+    recomputeSum();
+}
+
+void MouseHistory::recomputeSum()
+{
+    double currentWeight = 1.0;
+    m_sum = 0.0;
+    m_weight_total = 0.0;
+
+    for (int i = 0; i < m_count; i++)
+    {
+        m_sum += at(i) * currentWeight;
+        m_weight_total += currentWeight;
+        currentWeight *= m_weight_modifier;
+    }
+
+    m_pushes_since_recompute = 0;
+}
@@ -0,0 +1,64 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/**
+ * @brief History of cursor displacements along one axis used for mouse
+ *  smoothing.
+ *
+ * Holds the last size() values in a fixed ring buffer. The newest value has
+ * the weight 1, every older one is weighted with the weight modifier once
+ * more. The weighted sum is updated incrementally on every push, so
+ * weightedAverage() is O(1) and nothing is allocated after construction.
+ * Rounding errors of the incremental update are removed by recomputing the
+ * sum once per CAPACITY pushes.
+ */
+class MouseHistory
+{
+  public:
+    static const int CAPACITY = 100;
+
+    MouseHistory();
+
+    void setSize(int size);
+    inline int size() const { return m_size; }
+    inline int count() const { return m_count; }
+
+    void push(double value, double weightModifier);
+    void clear();
+    void fillWithZeros(double weightModifier);
+
+    double weightedAverage() const;
+    double at(int index) const;
+
+  private:
+    void setWeightModifier(double weightModifier);
+    void recomputeSum();
+
+    double m_values[CAPACITY];
+    int m_newest;
+    int m_count;
+    int m_size;
+    int m_pushes_since_recompute;
+
+    double m_weight_modifier;
+    // Weight of the oldest value in a full window, weightModifier^(size - 1).
+    double m_oldest_weight;
+    double m_sum;
+    double m_weight_total;
+};
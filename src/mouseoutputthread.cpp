@@ -0,0 +1,302 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mouseoutputthread.h"
+
+#include "eventhandlerfactory.h"
+#include "logger.h"
+
+#if defined(WITH_X11)
+    #include "x11extras.h"
+#endif
+
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <thread>
+
+#ifdef Q_OS_LINUX
+    #include <time.h>
+#endif
+
+const int MouseOutputThread::MINIMUM_RATE = 500;
+const int MouseOutputThread::MAXIMUM_RATE = 2000;
+
+std::atomic<MouseOutputThread *> MouseOutputThread::instance(nullptr);
+
+MouseOutputThread::MouseOutputThread(QObject *parent)
+    : QThread(parent)
+    , m_segments(64)
+    , m_total_x(0)
+    , m_total_y(0)
+    , m_sent_x(0)
+    , m_sent_y(0)
+    , m_interval_ns(0)
+    , m_rate(0)
+    , m_sleeping(false)
+    , m_quit(false)
+{
+}
+
+/**
+ * @brief Sets the output rate in Hz. 0 disables the thread and cursor
+ *  movement is sent directly by the mapping engine again.
+ *  The thread is created the first time a rate is set.
+ */
+void MouseOutputThread::setRate(int rate)
+{
+    if (rate > 0)
+        rate = qBound(MINIMUM_RATE, rate, MAXIMUM_RATE);
+    else
+        rate = 0;
+
+    MouseOutputThread *thread = instance.load();
+
+    if ((thread == nullptr) && (rate > 0))
+    {
+        thread = new MouseOutputThread();
+        thread->start(QThread::TimeCriticalPriority);
+        instance.store(thread);
+    }
+
+    if (thread != nullptr)
+    {
+        thread->m_rate.store(rate);
+        thread->wake();
+    }
+
+    DEBUG() << "Mouse output rate: " << rate << " Hz";
+}
+
+int MouseOutputThread::getRate()
+{
+    MouseOutputThread *thread = instance.load();
+    return (thread != nullptr) ? thread->m_rate.load() : 0;
+}
+
+/**
+ * @brief Hands a displacement over to the output thread. It is spread over
+ *  the estimated time until the next submit, intervalMs is the nominal
+ *  interval of the caller. Calls have to be serialized, all callers hold
+ *  the shared JoyButton lock.
+ * @return false if the output thread is disabled or full. The caller has
+ *  to send the displacement itself then.
+ */
+bool MouseOutputThread::submit(int xDis, int yDis, int intervalMs)
+{
+    MouseOutputThread *thread = instance.load(std::memory_order_acquire);
+
+    if ((thread == nullptr) || (thread->m_rate.load(std::memory_order_relaxed) == 0))
+        return false;
+
+    if (!thread->m_segments.push(MotionSegment{xDis, yDis, qMax(1, intervalMs) * 1000000LL, Clock::now()}))
+        return false;
+
+    thread->wake();
+    return true;
+}
+
+/**
+ * @brief Sends all movement which was submitted but not sent yet in the
+ *  calling thread. Called before mouse buttons and direct cursor movement
+ *  are sent, so they are not sent before earlier movement.
+ */
+void MouseOutputThread::flush()
+{
+    MouseOutputThread *thread = instance.load(std::memory_order_acquire);
+
+    if (thread == nullptr)
+        return;
+
+    QMutexLocker locker(&thread->m_motion_mutex);
+    thread->takeSegments();
+    thread->sendRemaining(EventHandlerFactory::getInstance()->handler());
+}
+
+/**
+ * @brief Sends remaining movement and stops the thread. Has to be called
+ *  before the event handler is cleaned up.
+ */
+void MouseOutputThread::shutdown()
+{
+    MouseOutputThread *thread = instance.exchange(nullptr);
+
+    if (thread == nullptr)
+        return;
+
+    thread->m_quit.store(true);
+    thread->m_wakeup.release();
+    thread->wait();
+    delete thread;
+}
+
+void MouseOutputThread::wake()
+{
+    if (m_sleeping.exchange(false))
+        m_wakeup.release();
+}
+
+/**
+ * @brief Blocks until new movement arrives. A wakeup between the check and
+ *  acquire() leaves a permit behind, so it can not get lost.
+ */
+void MouseOutputThread::park()
+{
+    m_sleeping.store(true);
+
+    if (m_segments.isEmpty() && !m_quit.load())
+        m_wakeup.acquire();
+
+    m_sleeping.store(false);
+}
+
+/**
+ * @brief Adds new displacements to the movement which is not sent yet and
+ *  updates the estimated time between two submits. Has to be called with
+ *  m_motion_mutex held.
+ */
+void MouseOutputThread::takeSegments()
+{
+    MotionSegment segment;
+
+    while (m_segments.pop(segment))
+    {
+        qint64 sinceLastNs =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(segment.submitted - m_last_submitted).count();
+
+        // A longer pause means the movement starts again. Then the interval
+        // of the caller is the best guess until more submits arrive.
+        if ((m_interval_ns == 0) || (sinceLastNs > 2 * segment.intervalNs))
+            m_interval_ns = segment.intervalNs;
+        else
+            m_interval_ns += (sinceLastNs - m_interval_ns) / 4;
+
+        m_last_submitted = segment.submitted;
+        m_total_x = segment.xDis + (m_total_x - m_sent_x);
+        m_total_y = segment.yDis + (m_total_y - m_sent_y);
+        m_sent_x = m_sent_y = 0;
+        m_segment_start = segment.submitted;
+    }
+}
+
+/**
+ * @brief Sends the part of the current movement which is due at the end of
+ *  the current tick. Has to be called with m_motion_mutex held.
+ * @return false if there was nothing left to send
+ */
+bool MouseOutputThread::sendStep(BaseEventHandler *handler, qint64 tickNs)
+{
+    if ((m_sent_x == m_total_x) && (m_sent_y == m_total_y))
+        return false;
+
+    // The current tick counts as done, so the first part of new movement
+    // is sent right away.
+    qint64 elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - m_segment_start).count();
+    double progress = qMin(1.0, static_cast<double>(elapsedNs + tickNs) / qMax(1LL, m_interval_ns));
+    int stepX = static_cast<int>(std::lround(m_total_x * progress)) - m_sent_x;
+    int stepY = static_cast<int>(std::lround(m_total_y * progress)) - m_sent_y;
+
+    if ((stepX != 0) || (stepY != 0))
+    {
+        handler->sendMouseEvent(stepX, stepY);
+        m_sent_x += stepX;
+        m_sent_y += stepY;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Sends the whole movement which is not sent yet at once. Has to be
+ *  called with m_motion_mutex held.
+ */
+void MouseOutputThread::sendRemaining(BaseEventHandler *handler)
+{
+    if ((m_sent_x != m_total_x) || (m_sent_y != m_total_y))
+        handler->sendMouseEvent(m_total_x - m_sent_x, m_total_y - m_sent_y);
+
+    m_sent_x = m_total_x;
+    m_sent_y = m_total_y;
+}
+
+static void sleepUntil(std::chrono::steady_clock::time_point deadline)
+{
+#ifdef Q_OS_LINUX
+    // steady_clock is CLOCK_MONOTONIC here. Absolute deadlines do not drift
+    // by the time spent sending events.
+    qint64 ns = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+    struct timespec target;
+    target.tv_sec = static_cast<time_t>(ns / 1000000000LL);
+    target.tv_nsec = static_cast<long>(ns % 1000000000LL);
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, nullptr) == EINTR)
+    {
+    }
+#else
+    std::this_thread::sleep_until(deadline);
+#endif
+}
+
+void MouseOutputThread::run()
+{
+    Clock::time_point deadline = Clock::now();
+    BaseEventHandler *handler = EventHandlerFactory::getInstance()->handler();
+
+    while (!m_quit.load())
+    {
+        int rate = m_rate.load();
+        qint64 tickNs = (rate > 0) ? (1000000000LL / rate) : 0;
+        bool pending = false;
+
+        {
+            QMutexLocker locker(&m_motion_mutex);
+            takeSegments();
+
+            if (rate == 0)
+                sendRemaining(handler);
+            else
+                pending = sendStep(handler, tickNs);
+        }
+
+        if (!pending)
+        {
+            park();
+            deadline = Clock::now();
+            continue;
+        }
+
+        // Skip ticks which were missed instead of sending them in a burst.
+        Clock::time_point now = Clock::now();
+        deadline += std::chrono::nanoseconds(tickNs);
+
+        if (deadline < now)
+            deadline = now + std::chrono::nanoseconds(tickNs);
+
+        sleepUntil(deadline);
+    }
+
+    {
+        QMutexLocker locker(&m_motion_mutex);
+        takeSegments();
+        sendRemaining(handler);
+    }
+
+#if defined(WITH_X11)
+    // XTest opens a display connection per thread.
+    X11Extras::deleteInstance();
+#endif
+}
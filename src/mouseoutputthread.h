@@ -0,0 +1,109 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MOUSEOUTPUTTHREAD_H
+#define MOUSEOUTPUTTHREAD_H
+
+#include "spscqueue.h"
+
+#include <QMutex>
+#include <QSemaphore>
+#include <QThread>
+
+#include <atomic>
+#include <chrono>
+
+class BaseEventHandler;
+
+/**
+ * @brief Sends relative cursor movement at a fixed high rate.
+ *
+ * The mapping engine computes one displacement per mouse refresh interval.
+ * Sending it at once makes the cursor jump in steps of the refresh rate and
+ * every bit of QTimer jitter shows up as uneven motion. Instead the
+ * displacement is handed over through a lock-free queue and sent in ticks of
+ * 500 to 2000 Hz, timed with absolute deadlines. Displacement which was not
+ * sent yet when the next one arrives is carried over, so nothing is lost
+ * when the mapping timer fires early.
+ *
+ * The first part of a displacement is sent as soon as it arrives and the
+ * rest is spread over the time until the next one is expected. That time
+ * is estimated from the submit timestamps, since the timers of the mouse
+ * helper and the gyroscope do not fire exactly at their nominal interval.
+ * The interval passed by the caller is only used when movement starts.
+ *
+ * Mouse buttons are still sent by the mapping engine. It calls flush()
+ * before, so a click never overtakes the movement that preceded it.
+ *
+ * The thread only wakes up while there is movement to send.
+ */
+class MouseOutputThread : public QThread
+{
+    Q_OBJECT
+
+  public:
+    static const int MINIMUM_RATE;
+    static const int MAXIMUM_RATE;
+
+    static void setRate(int rate);
+    static int getRate();
+    static bool submit(int xDis, int yDis, int intervalMs);
+    static void flush();
+    static void shutdown();
+
+  protected:
+    virtual void run() override;
+
+  private:
+    explicit MouseOutputThread(QObject *parent = nullptr);
+
+    using Clock = std::chrono::steady_clock;
+
+    struct MotionSegment
+    {
+        int xDis;
+        int yDis;
+        qint64 intervalNs;
+        Clock::time_point submitted;
+    };
+
+    void wake();
+    void park();
+    void takeSegments();
+    bool sendStep(BaseEventHandler *handler, qint64 tickNs);
+    void sendRemaining(BaseEventHandler *handler);
+
+    static std::atomic<MouseOutputThread *> instance;
+
+    SPSCQueue<MotionSegment> m_segments;
+    // Guards the consumer side of the queue and the movement which is
+    // currently spread, so flush() can send it from the mapping engine.
+    QMutex m_motion_mutex;
+    int m_total_x;
+    int m_total_y;
+    int m_sent_x;
+    int m_sent_y;
+    qint64 m_interval_ns;
+    Clock::time_point m_segment_start;
+    Clock::time_point m_last_submitted;
+    std::atomic<int> m_rate;
+    std::atomic<bool> m_sleeping;
+    std::atomic<bool> m_quit;
+    QSemaphore m_wakeup;
+};
+
+#endif // MOUSEOUTPUTTHREAD_H
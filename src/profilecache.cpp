@@ -0,0 +1,307 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "profilecache.h"
+
+#include "common.h"
+#include "globalvariables.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
+
+#include <cstring>
+
+#ifdef Q_OS_UNIX
+    #include <sys/stat.h>
+#endif
+
+const char ProfileCache::MAGIC[8] = {'A', 'M', 'X', 'P', 'R', 'O', 'F', '\0'};
+const quint32 ProfileCache::FORMAT_VERSION = 2;
+bool ProfileCache::enabled = true;
+
+ProfileCache::ProfileCache()
+    : m_map(nullptr)
+{
+}
+
+ProfileCache::~ProfileCache() { close(); }
+
+/**
+ * @brief Maps the cache of the given profile if it matches the current
+ *  content of the profile.
+ * @return false if there is no usable cache. The XML file has to be read then.
+ */
+bool ProfileCache::open(const QString &profilePath)
+{
+    close();
+
+    if (!enabled)
+        return false;
+
+    m_file.setFileName(cachePath(profilePath));
+
+    if (!m_file.exists() || !m_file.open(QIODevice::ReadOnly))
+        return false;
+
+    m_map = m_file.map(0, m_file.size());
+
+    if (m_map == nullptr)
+    {
+        close();
+        return false;
+    }
+
+    QByteArray raw = QByteArray::fromRawData(reinterpret_cast<const char *>(m_map), static_cast<int>(m_file.size()));
+    QDataStream stream(raw);
+    char magic[sizeof(MAGIC)];
+    quint32 formatVersion = 0;
+    qint32 configVersion = 0;
+    QString appVersion;
+    SourceStamp stamp;
+    quint32 payloadSize = 0;
+
+    stream.readRawData(magic, sizeof(magic));
+    stream >> formatVersion;
+
+    // Older formats do not have the same header.
+    if (formatVersion == FORMAT_VERSION)
+        stream >> configVersion >> appVersion >> stamp.size >> stamp.lastModified >> stamp.inode >> payloadSize;
+
+    qint64 payloadOffset = stream.device()->pos();
+
+    bool valid = (stream.status() == QDataStream::Ok) && (memcmp(magic, MAGIC, sizeof(MAGIC)) == 0) &&
+                 (formatVersion == FORMAT_VERSION) && (configVersion == PadderCommon::LATESTCONFIGFILEVERSION) &&
+                 (appVersion == PadderCommon::programVersion) && (payloadOffset + payloadSize == m_file.size()) &&
+                 (stamp == sourceStamp(profilePath));
+
+    if (!valid)
+    {
+        qDebug() << "Minified profile cache is stale:" << m_file.fileName();
+        close();
+        return false;
+    }
+
+    m_payload =
+        QByteArray::fromRawData(reinterpret_cast<const char *>(m_map + payloadOffset), static_cast<int>(payloadSize));
+
+    qDebug() << "Loading profile" << profilePath << "from minified cache";
+    return true;
+}
+
+void ProfileCache::close()
+{
+    m_payload.clear();
+
+    if (m_map != nullptr)
+    {
+        m_file.unmap(m_map);
+        m_map = nullptr;
+    }
+
+    if (m_file.isOpen())
+        m_file.close();
+}
+
+/**
+ * @brief Minifies the current content of the profile and writes the cache.
+ *  Profiles which still need a migration are not cached, they have to be
+ *  read through XMLConfigReader first.
+ * @return minified payload, empty on failure
+ */
+QByteArray ProfileCache::compile(const QString &profilePath)
+{
+    // The stamp is taken before reading, a change while reading makes
+    // the cache stale right away.
+    SourceStamp stamp = sourceStamp(profilePath);
+    QFile source(profilePath);
+
+    if (!source.open(QIODevice::ReadOnly))
+        return QByteArray();
+
+    QByteArray content = source.readAll();
+    source.close();
+
+    QByteArray payload = minify(content);
+
+    if (payload.isEmpty() || !enabled || !(stamp == sourceStamp(profilePath)))
+        return payload;
+
+    QString path = cachePath(profilePath);
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    QSaveFile cacheFile(path);
+
+    if (!cacheFile.open(QIODevice::WriteOnly))
+        return payload;
+
+    QDataStream stream(&cacheFile);
+    stream.writeRawData(MAGIC, sizeof(MAGIC));
+    stream << FORMAT_VERSION << static_cast<qint32>(PadderCommon::LATESTCONFIGFILEVERSION) << PadderCommon::programVersion
+           << stamp.size << stamp.lastModified << stamp.inode << static_cast<quint32>(payload.size());
+    stream.writeRawData(payload.constData(), payload.size());
+
+    if ((stream.status() != QDataStream::Ok) || !cacheFile.commit())
+        qDebug() << "Could not write compiled profile cache" << path;
+
+    return payload;
+}
+
+/**
+ * @brief Returns the compiled payload of a profile, from its cache if that is
+ *  up to date or by compiling it otherwise. Safe to call from any thread.
+ */
+QByteArray ProfileCache::loadPayload(const QString &profilePath)
+{
+    ProfileCache cache;
+
+    if (cache.open(profilePath))
+        return QByteArray(cache.payload().constData(), cache.payload().size());
+
+    return compile(profilePath);
+}
+
+void ProfileCache::discard(const QString &profilePath) { QFile::remove(cachePath(profilePath)); }
+
+QString ProfileCache::cachePath(const QString &profilePath)
+{
+    QByteArray key =
+        QCryptographicHash::hash(QFileInfo(profilePath).absoluteFilePath().toUtf8(), QCryptographicHash::Sha1).toHex();
+
+    return QString("%1/profiles/%2.bin")
+        .arg(QStandardPaths::writableLocation(QStandardPaths::CacheLocation), QString::fromLatin1(key));
+}
+
+void ProfileCache::setEnabled(bool enabled) { ProfileCache::enabled = enabled; }
+
+bool ProfileCache::isEnabled() { return enabled; }
+
+/**
+ * @brief Identifies the current version of a profile without reading it.
+ *  The inode catches profiles replaced by an atomic save within the
+ *  resolution of the modification time.
+ */
+ProfileCache::SourceStamp ProfileCache::sourceStamp(const QString &profilePath)
+{
+    SourceStamp stamp;
+    QFileInfo info(profilePath);
+
+    if (!info.exists())
+        return stamp;
+
+    stamp.size = info.size();
+    stamp.lastModified = info.lastModified().toMSecsSinceEpoch();
+
+#ifdef Q_OS_UNIX
+    struct stat status;
+
+    if (stat(QFile::encodeName(profilePath).constData(), &status) == 0)
+        stamp.inode = static_cast<quint64>(status.st_ino);
+#endif
+
+    return stamp;
+}
+
+bool ProfileCache::SourceStamp::operator==(const SourceStamp &other) const
+{
+    return (size >= 0) && (size == other.size) && (lastModified == other.lastModified) && (inode == other.inode);
+}
+
+/**
+ * @brief Rewrites the profile without comments, indentation and the
+ *  informational elements below the root element.
+ *  Whitespace is kept when it is the whole content of an element.
+ * @return empty array if the profile is not well-formed or needs a migration
+ */
+QByteArray ProfileCache::minify(const QByteArray &source)
+{
+    QByteArray result;
+    QXmlStreamReader reader(source);
+    QXmlStreamWriter writer(&result);
+    QString pendingWhitespace;
+    bool afterStartElement = false;
+    int depth = 0;
+
+    while (!reader.atEnd())
+    {
+        reader.readNext();
+
+        if (reader.isStartElement() && (depth == 1) &&
+            ((reader.name() == QLatin1String("sdlname")) || (reader.name() == QLatin1String("uniqueID")) ||
+             (reader.name() == QLatin1String("guid"))))
+        {
+            reader.skipCurrentElement();
+            afterStartElement = false;
+            pendingWhitespace.clear();
+            continue;
+        }
+
+        if (reader.isWhitespace())
+        {
+            if (afterStartElement)
+                pendingWhitespace = reader.text().toString();
+
+            continue;
+        }
+
+        if (reader.isEndElement() && !pendingWhitespace.isEmpty())
+            writer.writeCharacters(pendingWhitespace);
+
+        pendingWhitespace.clear();
+
+        if (reader.isStartElement() && (depth == 0) && (reader.name() == GlobalVariables::Joystick::xmlName))
+        {
+            int fileVersion = reader.attributes().value("configversion").toString().toInt();
+
+            if ((fileVersion >= 2) && (fileVersion <= PadderCommon::LATESTCONFIGMIGRATIONVERSION))
+                return QByteArray();
+        }
+
+        switch (reader.tokenType())
+        {
+        case QXmlStreamReader::StartElement:
+            depth++;
+            writer.writeCurrentToken(reader);
+            break;
+        case QXmlStreamReader::EndElement:
+            depth--;
+            writer.writeCurrentToken(reader);
+            break;
+        case QXmlStreamReader::Comment:
+        case QXmlStreamReader::DTD:
+        case QXmlStreamReader::ProcessingInstruction:
+            break;
+        default:
+            writer.writeCurrentToken(reader);
+            break;
+        }
+
+        afterStartElement = reader.isStartElement();
+    }
+
+    if (reader.hasError())
+        return QByteArray();
+
+    return result;
+}
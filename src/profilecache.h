@@ -0,0 +1,77 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+
+/**
+ * @brief Minified form of a profile which is loaded instead of the XML file
+ *  as long as it is up to date.
+ *
+ * The cache holds the already migrated profile without comments, indentation
+ * and informational elements. It still goes through the regular XML readers,
+ * it only saves reading and tokenizing the parts which are dropped. It is
+ * validated by the size, modification time and inode of the XML file, the
+ * application version and the config file version, so opening it does not
+ * read the XML file at all. Every change of one of them falls back to the
+ * XML file and writes a new cache afterwards. Cache files live in the cache
+ * directory of the application and are memory mapped while being read.
+ */
+class ProfileCache
+{
+  public:
+    ProfileCache();
+    ~ProfileCache();
+
+    bool open(const QString &profilePath);
+    void close();
+    inline const QByteArray &payload() const { return m_payload; }
+
+    static QByteArray compile(const QString &profilePath);
+    static QByteArray loadPayload(const QString &profilePath);
+    static void discard(const QString &profilePath);
+    static QString cachePath(const QString &profilePath);
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+  private:
+    Q_DISABLE_COPY(ProfileCache)
+
+    struct SourceStamp
+    {
+        qint64 size = -1;
+        qint64 lastModified = 0;
+        quint64 inode = 0;
+
+        bool operator==(const SourceStamp &other) const;
+    };
+
+    static SourceStamp sourceStamp(const QString &profilePath);
+    static QByteArray minify(const QByteArray &source);
+
+    static const char MAGIC[8];
+    static const quint32 FORMAT_VERSION;
+    static bool enabled;
+
+    QFile m_file;
+    uchar *m_map;
+    QByteArray m_payload;
+};
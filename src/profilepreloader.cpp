@@ -0,0 +1,163 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "profilepreloader.h"
+
+#include "profilecache.h"
+
+#include <QCoreApplication>
+#include <QDebug>
+#include <QFileInfo>
+#include <QMutexLocker>
+#include <QtConcurrent>
+
+ProfilePreloader *ProfilePreloader::instance = nullptr;
+
+ProfilePreloader::ProfilePreloader(QObject *parent)
+    : QObject(parent)
+    , m_generation(0)
+{
+    // Preloading is not urgent, one job at a time keeps the disk free for
+    // the profile which is loaded right now.
+    m_thread_pool.setMaxThreadCount(1);
+}
+
+/**
+ * @brief Pending jobs only touch the pool, wait for them before it goes away.
+ */
+ProfilePreloader::~ProfilePreloader()
+{
+    {
+        QMutexLocker locker(&m_pool_mutex);
+        m_wanted.clear();
+        m_generation++;
+    }
+
+    m_thread_pool.waitForDone();
+    instance = nullptr;
+}
+
+/**
+ * @brief Has to be called from the GUI thread first.
+ */
+ProfilePreloader *ProfilePreloader::getInstance()
+{
+    if (instance == nullptr)
+        instance = new ProfilePreloader(qApp);
+
+    return instance;
+}
+
+/**
+ * @brief Replaces the set of preloaded profiles. Profiles which are not
+ *  listed anymore are dropped, new or changed ones are loaded in the
+ *  background.
+ */
+void ProfilePreloader::preload(const QStringList &profilePaths)
+{
+    QStringList pending;
+    quint64 generation = 0;
+
+    {
+        QMutexLocker locker(&m_pool_mutex);
+        m_wanted.clear();
+
+        for (const QString &path : profilePaths)
+        {
+            if (!path.isEmpty())
+                m_wanted.insert(QFileInfo(path).absoluteFilePath());
+        }
+
+        for (auto iter = m_pool.begin(); iter != m_pool.end();)
+        {
+            if (m_wanted.contains(iter.key()))
+                ++iter;
+            else
+                iter = m_pool.erase(iter);
+        }
+
+        for (const QString &path : qAsConst(m_wanted))
+        {
+            QFileInfo info(path);
+            auto iter = m_pool.constFind(path);
+
+            if ((iter == m_pool.constEnd()) || (iter.value().size != info.size()) ||
+                (iter.value().lastModified != info.lastModified()))
+            {
+                pending.append(path);
+            }
+        }
+
+        generation = ++m_generation;
+    }
+
+    for (const QString &path : qAsConst(pending))
+        QtConcurrent::run(&m_thread_pool, [this, path, generation] { load(path, generation); });
+}
+
+/**
+ * @brief Runs on the thread pool of the preloader. Profiles which need a
+ *  migration have no payload and are skipped, they are migrated when they
+ *  are actually loaded.
+ */
+void ProfilePreloader::load(const QString &profilePath, quint64 generation)
+{
+    QFileInfo info(profilePath);
+    qint64 size = info.size();
+    QDateTime lastModified = info.lastModified();
+    QByteArray payload = ProfileCache::loadPayload(profilePath);
+
+    if (payload.isEmpty())
+        return;
+
+    QMutexLocker locker(&m_pool_mutex);
+
+    if ((generation == m_generation) && m_wanted.contains(profilePath))
+    {
+        m_pool.insert(profilePath, PreloadedProfile{payload, size, lastModified});
+        qDebug() << "Preloaded profile" << profilePath;
+    }
+}
+
+/**
+ * @brief Looks up a preloaded profile which still matches its file.
+ *  Safe to call from any thread.
+ */
+bool ProfilePreloader::lookup(const QString &profilePath, QByteArray *payload)
+{
+    if (instance == nullptr)
+        return false;
+
+    QFileInfo info(profilePath);
+    QMutexLocker locker(&instance->m_pool_mutex);
+    auto iter = instance->m_pool.constFind(info.absoluteFilePath());
+
+    if ((iter == instance->m_pool.constEnd()) || (iter.value().size != info.size()) ||
+        (iter.value().lastModified != info.lastModified()))
+    {
+        return false;
+    }
+
+    *payload = iter.value().payload;
+    return true;
+}
+
+int ProfilePreloader::getPreloadedCount()
+{
+    QMutexLocker locker(&m_pool_mutex);
+    return m_pool.size();
+}
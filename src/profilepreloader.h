@@ -0,0 +1,79 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PROFILEPRELOADER_H
+#define PROFILEPRELOADER_H
+
+#include <QByteArray>
+#include <QDateTime>
+#include <QHash>
+#include <QMutex>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
+#include <QThreadPool>
+
+/**
+ * @brief Keeps minified payloads of profiles which are likely to be loaded
+ *  soon, e.g. all profiles referenced by auto profile rules.
+ *
+ * Reading the file and minifying it happen on a thread pool of the
+ * preloader, so a later switch to one of these profiles does not touch the
+ * disk. The switch itself still resets the device and rebuilds its sets from
+ * the payload on the thread owning the device, input arriving meanwhile
+ * waits until it is done. Profiles which still need a migration are not
+ * preloaded, the preloader never writes profile files. Entries are checked
+ * against size and modification time of the profile file before they are used.
+ */
+class ProfilePreloader : public QObject
+{
+    Q_OBJECT
+
+  public:
+    ~ProfilePreloader();
+
+    static ProfilePreloader *getInstance();
+
+    void preload(const QStringList &profilePaths);
+    static bool lookup(const QString &profilePath, QByteArray *payload);
+
+    int getPreloadedCount();
+
+  private:
+    explicit ProfilePreloader(QObject *parent = nullptr);
+
+    struct PreloadedProfile
+    {
+        QByteArray payload;
+        qint64 size;
+        QDateTime lastModified;
+    };
+
+    void load(const QString &profilePath, quint64 generation);
+
+    static ProfilePreloader *instance;
+
+    QMutex m_pool_mutex;
+    QHash<QString, PreloadedProfile> m_pool;
+    QSet<QString> m_wanted;
+    quint64 m_generation;
+    // Not the global pool, so waiting for preload jobs does not wait for
+    // profile writes.
+    QThreadPool m_thread_pool;
+};
+
+#endif // PROFILEPRELOADER_H
@@ -0,0 +1,170 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sdldevicewatcher.h"
+
+#include <SDL2/SDL.h>
+
+#include <QDebug>
+#include <QDir>
+#include <QSocketNotifier>
+
+#ifdef Q_OS_LINUX
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+SDLDeviceWatcher::SDLDeviceWatcher(QObject *parent)
+    : QObject(parent)
+    , m_directory_watcher(this)
+    , m_complete(false)
+{
+#ifdef Q_OS_LINUX
+    // evdev nodes live in /dev/input, hidraw nodes directly in /dev.
+    // inotify can not filter by name, so changes of /dev are compared
+    // against the known hidraw nodes.
+    for (const QString &path : {QString("/dev/input"), QString("/dev")})
+    {
+        if (QDir(path).exists())
+            m_directory_watcher.addPath(path);
+    }
+
+    m_hidraw_nodes = hidrawNodes();
+    connect(&m_directory_watcher, &QFileSystemWatcher::directoryChanged, this, &SDLDeviceWatcher::directoryChanged);
+#endif
+}
+
+SDLDeviceWatcher::~SDLDeviceWatcher() { clear(); }
+
+/**
+ * @brief Opens and watches the device nodes of all joysticks SDL knows
+ *  about. Has to be called on the thread which runs the watcher.
+ * @return true if every joystick is watched
+ */
+bool SDLDeviceWatcher::refresh()
+{
+    clear();
+
+#if defined(Q_OS_LINUX) && SDL_VERSION_ATLEAST(2, 24, 0)
+    bool complete = true;
+    int count = SDL_NumJoysticks();
+
+    for (int i = 0; i < count; i++)
+    {
+        const char *path = SDL_JoystickPathForIndex(i);
+        int fd = (path != nullptr) ? open(path, O_RDONLY | O_NONBLOCK | O_CLOEXEC) : -1;
+
+        if (fd < 0)
+        {
+            // Virtual joysticks have no node and some nodes can not be
+            // opened a second time. SDL has to be polled for them.
+            qDebug() << "Can not watch joystick" << i << "at" << (path != nullptr ? path : "no path");
+            complete = false;
+            continue;
+        }
+
+        QSocketNotifier *notifier = new QSocketNotifier(fd, QSocketNotifier::Read, this);
+        connect(notifier, SIGNAL(activated(int)), this, SLOT(drainDevice(int)));
+        m_notifiers.append(notifier);
+    }
+
+    m_complete = complete;
+#else
+    m_complete = false;
+#endif
+
+    return m_complete;
+}
+
+/**
+ * @brief Stops watching and closes all device nodes.
+ */
+void SDLDeviceWatcher::clear()
+{
+    for (QSocketNotifier *notifier : qAsConst(m_notifiers))
+    {
+        notifier->setEnabled(false);
+#ifdef Q_OS_LINUX
+        close(static_cast<int>(notifier->socket()));
+#endif
+        delete notifier;
+    }
+
+    m_notifiers.clear();
+    m_complete = false;
+}
+
+bool SDLDeviceWatcher::isComplete() const { return m_complete; }
+
+/**
+ * @brief Reports a change of /dev/input and changes of /dev which
+ *  added or removed a hidraw node.
+ */
+void SDLDeviceWatcher::directoryChanged(const QString &path)
+{
+    if (path == "/dev")
+    {
+        QStringList nodes = hidrawNodes();
+
+        if (nodes == m_hidraw_nodes)
+            return;
+
+        m_hidraw_nodes = nodes;
+    }
+
+    emit devicesChanged();
+}
+
+QStringList SDLDeviceWatcher::hidrawNodes()
+{
+    return QDir("/dev").entryList({"hidraw*"}, QDir::System | QDir::NoDotAndDotDot, QDir::Name);
+}
+
+/**
+ * @brief Throws away the copy of the input which woke up the thread.
+ *  SDL reads the same input from its own file descriptor.
+ */
+void SDLDeviceWatcher::drainDevice(int fd)
+{
+#ifdef Q_OS_LINUX
+    char buffer[4096];
+    ssize_t result = 0;
+
+    do
+    {
+        result = read(fd, buffer, sizeof(buffer));
+    } while (result > 0);
+
+    if ((result < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
+    {
+        // The device is gone. Stop watching it until the next refresh.
+        for (QSocketNotifier *notifier : qAsConst(m_notifiers))
+        {
+            if (notifier->socket() == fd)
+                notifier->setEnabled(false);
+        }
+
+        m_complete = false;
+        emit devicesChanged();
+    }
+#else
+    Q_UNUSED(fd);
+#endif
+
+    emit activity();
+}
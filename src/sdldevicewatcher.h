@@ -0,0 +1,73 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDLDEVICEWATCHER_H
+#define SDLDEVICEWATCHER_H
+
+#include <QFileSystemWatcher>
+#include <QList>
+#include <QObject>
+#include <QStringList>
+
+class QSocketNotifier;
+
+/**
+ * @brief Watches the device nodes behind the SDL joysticks so the SDL
+ *  reader thread can sleep in its event loop until a device reports input.
+ *
+ * SDL_WaitEventTimeout does not block in the kernel once a joystick is open,
+ * it pumps and sleeps in 1 ms steps. Instead every evdev or hidraw node SDL
+ * reads from is opened a second time and watched with a QSocketNotifier.
+ * Each open file has its own kernel queue, so draining the copy does not
+ * take anything away from SDL. Hotplug is noticed through inotify on
+ * /dev/input and on the hidraw nodes in /dev, other device nodes coming
+ * and going in /dev are ignored.
+ *
+ * Watching needs SDL 2.24 for the device paths and is only implemented on
+ * Linux. isComplete() tells whether every joystick is covered, the reader
+ * has to keep polling otherwise.
+ */
+class SDLDeviceWatcher : public QObject
+{
+    Q_OBJECT
+
+  public:
+    explicit SDLDeviceWatcher(QObject *parent = nullptr);
+    ~SDLDeviceWatcher();
+
+    bool refresh();
+    void clear();
+    bool isComplete() const;
+
+  signals:
+    void activity();
+    void devicesChanged();
+
+  private slots:
+    void drainDevice(int fd);
+    void directoryChanged(const QString &path);
+
+  private:
+    static QStringList hidrawNodes();
+
+    QList<QSocketNotifier *> m_notifiers;
+    QFileSystemWatcher m_directory_watcher;
+    QStringList m_hidraw_nodes;
+    bool m_complete;
+};
+
+#endif // SDLDEVICEWATCHER_H
@@ -0,0 +1,174 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sdleventhandoff.h"
+
+#include "sdleventring.h"
+
+#include <QDebug>
+#include <QSocketNotifier>
+
+#include <chrono>
+#include <cmath>
+
+#ifdef Q_OS_LINUX
+    #include <sys/eventfd.h>
+    #include <unistd.h>
+#endif
+
+const int SDLEventHandoff::DEFAULT_CAPACITY = 1024;
+
+SDLEventHandoff::SDLEventHandoff(QObject *parent)
+    : QObject(parent)
+    , m_queue(DEFAULT_CAPACITY)
+    , m_wakeup_pending(false)
+    , m_event_fd(-1)
+    , m_notifier(nullptr)
+    , m_max_latency(0)
+{
+#ifdef Q_OS_LINUX
+    m_event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (m_event_fd >= 0)
+    {
+        m_notifier = new QSocketNotifier(m_event_fd, QSocketNotifier::Read, this);
+    #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+        connect(m_notifier, SIGNAL(activated(QSocketDescriptor, QSocketNotifier::Type)), this, SLOT(consumeWakeup()));
+    #else
+        connect(m_notifier, SIGNAL(activated(int)), this, SLOT(consumeWakeup()));
+    #endif
+    } else
+    {
+        qWarning() << "Could not create eventfd for SDL event handoff. Falling back to queued wakeups.";
+    }
+#endif
+}
+
+SDLEventHandoff::~SDLEventHandoff()
+{
+#ifdef Q_OS_LINUX
+    if (m_event_fd >= 0)
+    {
+        delete m_notifier;
+        m_notifier = nullptr;
+        close(m_event_fd);
+    }
+#endif
+}
+
+/**
+ * @brief Number of events the producer can push without blocking.
+ */
+int SDLEventHandoff::freeSpace() const { return static_cast<int>(m_queue.freeSpace()); }
+
+/**
+ * @brief Stores an event for the consumer. Must only be called from the
+ *  producer thread.
+ * @returns false if the queue is full.
+ */
+bool SDLEventHandoff::push(const SDL_Event &event) { return m_queue.push({event, currentTimestamp()}); }
+
+/**
+ * @brief Wakes up the consumer thread unless a wakeup is already pending.
+ *  Must only be called from the producer thread after a batch was pushed.
+ */
+void SDLEventHandoff::notifyConsumer()
+{
+    if (m_wakeup_pending.exchange(true))
+        return;
+
+#ifdef Q_OS_LINUX
+    if (m_event_fd >= 0)
+    {
+        quint64 value = 1;
+        if (write(m_event_fd, &value, sizeof(value)) == sizeof(value))
+            return;
+    }
+#endif
+
+    QMetaObject::invokeMethod(this, "consumeWakeup", Qt::QueuedConnection);
+}
+
+void SDLEventHandoff::consumeWakeup()
+{
+#ifdef Q_OS_LINUX
+    if (m_event_fd >= 0)
+    {
+        quint64 value = 0;
+        if (read(m_event_fd, &value, sizeof(value)) < 0)
+            value = 0;
+    }
+#endif
+
+    // Clear the flag before the queue gets drained so events pushed
+    // from now on trigger another wakeup.
+    m_wakeup_pending.store(false);
+    emit eventsAvailable();
+}
+
+/**
+ * @brief Moves queued events into the ring until it is full and records
+ *  the time each event spent in the handoff.
+ * @returns Number of moved events.
+ */
+int SDLEventHandoff::drainInto(SDLEventRing *ring)
+{
+    int drained = 0;
+    qint64 now = currentTimestamp();
+    HandoffEntry entry;
+
+    while (!ring->isFull() && m_queue.pop(entry))
+    {
+        ring->enqueue(entry.event);
+
+        qint64 latency = now - entry.timestamp;
+        m_latency.process(latency / 1000.0);
+        m_max_latency = qMax(m_max_latency, latency);
+        drained++;
+    }
+
+    if (ring->isFull() && !m_queue.isEmpty())
+        ring->countOverflow();
+
+    return drained;
+}
+
+bool SDLEventHandoff::hasPendingEvents() const { return !m_queue.isEmpty(); }
+
+/**
+ * @brief Drops all queued events. Must only be called from the consumer thread.
+ */
+void SDLEventHandoff::clear() { m_queue.clear(); }
+
+/**
+ * @brief Summary of the time between pushing an event in the SDL thread
+ *  and draining it in the InputDaemon thread.
+ */
+QString SDLEventHandoff::getLatencyReport() const
+{
+    return QString("SDL event handoff latency: %1 events, mean %2 us, std. dev. %3 us, max %4 us")
+        .arg(m_latency.getCount())
+        .arg(m_latency.getMean(), 0, 'f', 1)
+        .arg((m_latency.getCount() > 1) ? std::sqrt(m_latency.calculateVariance()) : 0.0, 0, 'f', 1)
+        .arg(m_max_latency / 1000.0, 0, 'f', 1);
+}
+
+qint64 SDLEventHandoff::currentTimestamp()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
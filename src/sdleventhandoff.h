@@ -0,0 +1,86 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SDLEVENTHANDOFF_H
+#define SDLEVENTHANDOFF_H
+
+#include "spscqueue.h"
+#include "statisticsestimator.h"
+
+#include <SDL2/SDL_events.h>
+
+#include <QObject>
+
+#include <atomic>
+
+class SDLEventRing;
+class QSocketNotifier;
+
+/**
+ * @brief Passes SDL events from the SDLEventReader thread to the InputDaemon
+ *  thread through a lock-free single-producer/single-consumer queue.
+ *  The consumer is woken up at most once per batch. On Linux the wakeup
+ *  goes through an eventfd watched by a QSocketNotifier, elsewhere through
+ *  a single queued invocation.
+ *  Lives in the consumer thread.
+ */
+class SDLEventHandoff : public QObject
+{
+    Q_OBJECT
+
+  public:
+    explicit SDLEventHandoff(QObject *parent = nullptr);
+    ~SDLEventHandoff();
+
+    // Producer side
+    int freeSpace() const;
+    bool push(const SDL_Event &event);
+    void notifyConsumer();
+
+    // Consumer side
+    int drainInto(SDLEventRing *ring);
+    bool hasPendingEvents() const;
+    void clear();
+    QString getLatencyReport() const;
+
+    static const int DEFAULT_CAPACITY;
+
+  signals:
+    void eventsAvailable();
+
+  private slots:
+    void consumeWakeup();
+
+  private:
+    struct HandoffEntry
+    {
+        SDL_Event event;
+        qint64 timestamp;
+    };
+
+    static qint64 currentTimestamp();
+
+    SPSCQueue<HandoffEntry> m_queue;
+    std::atomic<bool> m_wakeup_pending;
+    int m_event_fd;
+    QSocketNotifier *m_notifier;
+
+    StatisticsEstimator m_latency;
+    qint64 m_max_latency;
+};
+
+#endif // SDLEVENTHANDOFF_H
@@ -0,0 +1,249 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sdleventplayer.h"
+
+#include "sdleventrecorder.h"
+#include "sdleventring.h"
+
+#include <SDL2/SDL_joystick.h>
+#include <SDL2/SDL_timer.h>
+
+#include <QDataStream>
+#include <QFile>
+#include <QObject>
+
+#include <cstring>
+
+SDLEventPlayer::SDLEventPlayer()
+    : m_position(0)
+{
+}
+
+/**
+ * @brief Loads a recorded session.
+ * @returns false if the file cannot be read or is not a valid recording.
+ */
+bool SDLEventPlayer::open(const QString &fileName)
+{
+    m_events.clear();
+    m_device_guids.clear();
+    m_targets.clear();
+    m_position = 0;
+    m_error.clear();
+
+    QFile file(fileName);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        m_error = QObject::tr("Could not open %1: %2").arg(fileName, file.errorString());
+        return false;
+    }
+
+    QDataStream stream(&file);
+    stream.setByteOrder(QDataStream::LittleEndian);
+    stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+
+    quint32 magic = 0;
+    quint16 version = 0;
+    stream >> magic >> version;
+
+    // Version 1 did not store sensor timestamps.
+    if ((magic != SDLEventRecorder::FILE_MAGIC) || (version < 1) || (version > SDLEventRecorder::FILE_VERSION))
+    {
+        m_error = QObject::tr("%1 is not a supported input recording.").arg(fileName);
+        return false;
+    }
+
+    while (!stream.atEnd() && (stream.status() == QDataStream::Ok))
+    {
+        quint8 kind = 0;
+        qint32 which = 0;
+        stream >> kind;
+
+        if (kind == SDLEventRecorder::DeviceRecord)
+        {
+            SDL_JoystickGUID guid = {};
+            char guidString[65] = {0};
+
+            stream >> which;
+            stream.readRawData(reinterpret_cast<char *>(guid.data), sizeof(guid.data));
+            SDL_JoystickGetGUIDString(guid, guidString, sizeof(guidString));
+            m_device_guids.insert(which, QString(guidString));
+        } else if (kind == SDLEventRecorder::EventRecord)
+        {
+            quint32 type = 0;
+            quint32 timestamp = 0;
+            quint8 index = 0;
+            quint8 value = 0;
+            qint16 axisValue = 0;
+            SDL_Event event;
+            memset(&event, 0, sizeof(event));
+
+            stream >> type >> timestamp >> which;
+            event.type = type;
+            event.common.timestamp = timestamp;
+
+            switch (type)
+            {
+            case SDL_JOYAXISMOTION:
+                stream >> index >> axisValue;
+                event.jaxis.which = which;
+                event.jaxis.axis = index;
+                event.jaxis.value = axisValue;
+                break;
+            case SDL_JOYBUTTONDOWN:
+            case SDL_JOYBUTTONUP:
+                stream >> index >> value;
+                event.jbutton.which = which;
+                event.jbutton.button = index;
+                event.jbutton.state = value;
+                break;
+            case SDL_JOYHATMOTION:
+                stream >> index >> value;
+                event.jhat.which = which;
+                event.jhat.hat = index;
+                event.jhat.value = value;
+                break;
+            case SDL_CONTROLLERAXISMOTION:
+                stream >> index >> axisValue;
+                event.caxis.which = which;
+                event.caxis.axis = index;
+                event.caxis.value = axisValue;
+                break;
+            case SDL_CONTROLLERBUTTONDOWN:
+            case SDL_CONTROLLERBUTTONUP:
+                stream >> index >> value;
+                event.cbutton.which = which;
+                event.cbutton.button = index;
+                event.cbutton.state = value;
+                break;
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+            case SDL_CONTROLLERSENSORUPDATE: {
+                qint32 sensor = 0;
+                quint64 sensorTimestamp = 0;
+                stream >> sensor >> event.csensor.data[0] >> event.csensor.data[1] >> event.csensor.data[2];
+
+                if (version >= 2)
+                    stream >> sensorTimestamp;
+
+                event.csensor.which = which;
+                event.csensor.sensor = sensor;
+    #if SDL_VERSION_ATLEAST(2, 26, 0)
+                event.csensor.timestamp_us = sensorTimestamp;
+    #endif
+                break;
+            }
+#endif
+            default:
+                m_error = QObject::tr("%1 contains an unsupported event type %2.").arg(fileName).arg(type);
+                return false;
+            }
+
+            m_events.push_back(event);
+        } else
+        {
+            m_error = QObject::tr("%1 is corrupted.").arg(fileName);
+            return false;
+        }
+    }
+
+    if (stream.status() != QDataStream::Ok)
+    {
+        m_error = QObject::tr("%1 is truncated.").arg(fileName);
+        return false;
+    }
+
+    return true;
+}
+
+QList<SDL_JoystickID> SDLEventPlayer::getRecordedDevices() const { return m_device_guids.keys(); }
+
+QString SDLEventPlayer::getRecordedGUIDString(SDL_JoystickID recorded) const { return m_device_guids.value(recorded); }
+
+/**
+ * @brief Sends events of a recorded device to a connected one.
+ */
+void SDLEventPlayer::setTargetDevice(SDL_JoystickID recorded, SDL_JoystickID target)
+{
+    m_targets.insert(recorded, target);
+}
+
+/**
+ * @brief Rewinds the session and starts its clock.
+ */
+void SDLEventPlayer::start()
+{
+    m_position = 0;
+    m_clock.start();
+}
+
+/**
+ * @brief Appends all events which are due since start() to the ring.
+ *  Events which do not fit are released with the next call.
+ * @returns Number of appended events.
+ */
+int SDLEventPlayer::takeDueEvents(SDLEventRing *ring)
+{
+    int taken = 0;
+    qint64 elapsed = m_clock.elapsed();
+    Uint32 now = SDL_GetTicks();
+
+    while (!atEnd() && !ring->isFull() && (m_events[m_position].common.timestamp <= elapsed))
+    {
+        SDL_Event event = m_events[m_position++];
+
+        if (mapEvent(event))
+        {
+            event.common.timestamp = now;
+            ring->enqueue(event);
+            taken++;
+        }
+    }
+
+    return taken;
+}
+
+/**
+ * @brief All events of mapped devices in recorded order, used to replay
+ *  a session as fast as possible.
+ */
+std::vector<SDL_Event> SDLEventPlayer::getMappedEvents() const
+{
+    std::vector<SDL_Event> events;
+    events.reserve(m_events.size());
+
+    for (SDL_Event event : m_events)
+    {
+        if (mapEvent(event))
+            events.push_back(event);
+    }
+
+    return events;
+}
+
+bool SDLEventPlayer::mapEvent(SDL_Event &event) const
+{
+    // All input event structures start with type, timestamp and instance id.
+    auto target = m_targets.constFind(event.jaxis.which);
+
+    if (target == m_targets.constEnd())
+        return false;
+
+    event.jaxis.which = target.value();
+    return true;
+}
@@ -0,0 +1,66 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <SDL2/SDL_events.h>
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
+#include <QString>
+
+#include <vector>
+
+class SDLEventRing;
+
+/**
+ * @brief Replays a session written by SDLEventRecorder.
+ *  The whole file is loaded at once. Recorded devices are mapped to
+ *  currently connected devices with setTargetDevice, events of unmapped
+ *  devices are skipped. Events are released with their original timing
+ *  relative to start().
+ */
+class SDLEventPlayer
+{
+  public:
+    SDLEventPlayer();
+
+    bool open(const QString &fileName);
+
+    QList<SDL_JoystickID> getRecordedDevices() const;
+    QString getRecordedGUIDString(SDL_JoystickID recorded) const;
+    void setTargetDevice(SDL_JoystickID recorded, SDL_JoystickID target);
+
+    void start();
+    int takeDueEvents(SDLEventRing *ring);
+    std::vector<SDL_Event> getMappedEvents() const;
+
+    inline bool atEnd() const { return m_position >= m_events.size(); }
+    inline int size() const { return static_cast<int>(m_events.size()); }
+    inline QString getErrorString() const { return m_error; }
+
+  private:
+    bool mapEvent(SDL_Event &event) const;
+
+    std::vector<SDL_Event> m_events;
+    QHash<SDL_JoystickID, QString> m_device_guids;
+    QHash<SDL_JoystickID, SDL_JoystickID> m_targets;
+    size_t m_position;
+    QElapsedTimer m_clock;
+    QString m_error;
+};
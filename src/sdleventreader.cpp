@@ -22,6 +22,7 @@
 #include "common.h"
 #include "globalvariables.h"
 #include "inputdevice.h"
+#include "sdleventhandoff.h"
 //#include "logger.h"
 
 #include <SDL2/SDL.h>
@@ -36,17 +37,24 @@ SDLEventReader::SDLEventReader(QMap<SDL_JoystickID, InputDevice *> *joysticks, A
 {
     this->joysticks = joysticks;
     this->settings = settings;
+    this->eventHandoff = nullptr;
+    this->deviceWatchStale = true;
     settings->getLock()->lock();
     this->pollRate =
         settings->value("GamepadPollRate", GlobalVariables::AntimicroSettings::defaultSDLGamepadPollRate).toUInt();
+    this->waitForEvents =
+        settings->value("GamepadWaitForEvents", GlobalVariables::AntimicroSettings::defaultSDLGamepadWaitForEvents).toBool();
     settings->getLock()->unlock();
 
     pollRateTimer.setParent(this);
     pollRateTimer.setTimerType(Qt::PreciseTimer);
+    deviceWatcher.setParent(this);
 
     initSDL();
 
     connect(&pollRateTimer, &QTimer::timeout, this, &SDLEventReader::performWork);
+    connect(&deviceWatcher, &SDLDeviceWatcher::activity, this, &SDLEventReader::deviceActivity);
+    connect(&deviceWatcher, &SDLDeviceWatcher::devicesChanged, this, &SDLEventReader::devicesChanged);
 }
 
 SDLEventReader::~SDLEventReader()
@@ -92,8 +100,10 @@ void SDLEventReader::initSDL()
     settings->endGroup();
     settings->getLock()->unlock();
 
+    // The device nodes are opened on the reader thread by the next performWork.
+    deviceWatchStale = true;
     pollRateTimer.stop();
-    pollRateTimer.setInterval(pollRate);
+    pollRateTimer.setInterval(pollTimerInterval());
 
     emit sdlStarted();
 }
@@ -101,6 +111,7 @@ void SDLEventReader::initSDL()
 void SDLEventReader::closeSDL()
 {
     pollRateTimer.stop();
+    deviceWatcher.clear();
 
     SDL_Event event;
 
@@ -123,8 +134,69 @@ void SDLEventReader::performWork()
     if (sdlIsOpen && (eventStatus() > 0))
     {
         pollRateTimer.stop();
-        emit eventRaised();
+
+        if (eventHandoff != nullptr)
+        {
+            handOffEvents();
+        } else
+        {
+            // The events are taken from SDL on the InputDaemon thread,
+            // so hotplug has to be noticed before handing over.
+            if (SDL_HasEvents(SDL_JOYDEVICEADDED, SDL_JOYDEVICEREMOVED))
+                deviceWatchStale = true;
+
+            emit eventRaised();
+        }
+    }
+
+    // SDL notices hotplug while pumping, so the nodes are reopened afterwards.
+    if (sdlIsOpen && waitForEvents && deviceWatchStale)
+        refreshDeviceWatch();
+}
+
+/**
+ * @brief Moves pending SDL events into the handoff queue, wakes up the
+ *  InputDaemon thread and keeps watching SDL without waiting for the
+ *  events to be processed.
+ */
+void SDLEventReader::handOffEvents()
+{
+    SDL_Event events[64];
+    int pushed = 0;
+    bool sdlDrained = false;
+
+    SDL_PumpEvents();
+
+    // Only take as many events from SDL as fit into the handoff.
+    // The rest stays queued in SDL until the consumer catches up.
+    while (!sdlDrained && (eventHandoff->freeSpace() > 0))
+    {
+        int batchSize = qMin(eventHandoff->freeSpace(), static_cast<int>(sizeof(events) / sizeof(events[0])));
+        int result = SDL_PeepEvents(events, batchSize, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+        if (result < 0)
+        {
+            qCritical() << QString("SDL Error: %1").arg(QString(SDL_GetError()));
+            break;
+        }
+
+        for (int i = 0; i < result; i++)
+        {
+            if ((events[i].type == SDL_JOYDEVICEADDED) || (events[i].type == SDL_JOYDEVICEREMOVED))
+                deviceWatchStale = true;
+
+            eventHandoff->push(events[i]);
+        }
+
+        pushed += result;
+        sdlDrained = result < batchSize;
     }
+
+    if (pushed > 0)
+        eventHandoff->notifyConsumer();
+
+    if (!pollRateTimer.isActive())
+        pollRateTimer.start();
 }
 
 void SDLEventReader::stop()
@@ -206,13 +278,94 @@ void SDLEventReader::updatePollRate(int tempPollRate)
         pollRateTimer.stop();
 
         this->pollRate = tempPollRate;
-        pollRateTimer.setInterval(pollRate);
+        pollRateTimer.setInterval(pollTimerInterval());
 
         if (pollTimerWasActive)
             pollRateTimer.start();
     }
 }
 
+/**
+ * @brief Switch between polling SDL every pollRate ms and sleeping until
+ *   one of the joystick device nodes reports input.
+ */
+void SDLEventReader::updateWaitForEvents(bool tempWaitForEvents)
+{
+    bool pollTimerWasActive = pollRateTimer.isActive();
+    pollRateTimer.stop();
+
+    this->waitForEvents = tempWaitForEvents;
+
+    if (waitForEvents)
+        refreshDeviceWatch();
+    else
+        deviceWatcher.clear();
+
+    pollRateTimer.setInterval(pollTimerInterval());
+
+    if (pollTimerWasActive)
+        pollRateTimer.start();
+}
+
+/**
+ * @brief Interval used to re-check SDL for events. While every joystick is
+ *   watched, input wakes the thread through the watcher and the timer only
+ *   catches hotplug events SDL has not announced yet. Otherwise SDL is
+ *   polled at the poll rate.
+ */
+int SDLEventReader::pollTimerInterval() const
+{
+    if (waitForEvents && deviceWatcher.isComplete())
+        return GlobalVariables::SDLEventReader::WAITEVENTTIMEOUT;
+
+    return pollRate;
+}
+
+/**
+ * @brief Reopens the device nodes of all joysticks known to SDL.
+ */
+void SDLEventReader::refreshDeviceWatch()
+{
+    deviceWatchStale = false;
+
+    if (!deviceWatcher.refresh() && waitForEvents)
+        qDebug() << "Not every joystick can be watched, SDL is polled at the poll rate";
+
+    if (pollRateTimer.interval() != pollTimerInterval())
+    {
+        bool pollTimerWasActive = pollRateTimer.isActive();
+        pollRateTimer.setInterval(pollTimerInterval());
+
+        if (pollTimerWasActive)
+            pollRateTimer.start();
+    }
+}
+
+/**
+ * @brief A watched device has new input. Only check SDL right away while the
+ *   reader is idle. While it is stopped, the pending check picks it up.
+ */
+void SDLEventReader::deviceActivity()
+{
+    if (pollRateTimer.isActive())
+        performWork();
+}
+
+/**
+ * @brief A device node appeared or vanished. Pump SDL once so it can notice
+ *   the change, the nodes are reopened afterwards.
+ */
+void SDLEventReader::devicesChanged()
+{
+    if (!waitForEvents)
+        return;
+
+    deviceWatchStale = true;
+
+    if (pollRateTimer.isActive())
+        performWork();
+}
+
 void SDLEventReader::resetJoystickMap() { joysticks = nullptr; }
 
 void SDLEventReader::quit()
@@ -278,3 +431,9 @@ QMap<SDL_JoystickID, InputDevice *> *SDLEventReader::getJoysticks() const { retu
 AntiMicroSettings *SDLEventReader::getSettings() const { return settings; }
 
 QTimer const &SDLEventReader::getPollRateTimer() { return pollRateTimer; }
+
+/**
+ * @brief Hand fetched events directly to the consumer instead of raising
+ *  eventRaised. Has to be set before the reader thread is started.
+ */
+void SDLEventReader::setEventHandoff(SDLEventHandoff *handoff) { eventHandoff = handoff; }
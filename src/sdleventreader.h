@@ -20,9 +20,11 @@
 #define SDLEVENTREADER_H
 
 #include "joystick.h"
+#include "sdldevicewatcher.h"
 
 class InputDevice;
 class AntiMicroSettings;
+class SDLEventHandoff;
 
 class SDLEventReader : public QObject
 {
@@ -38,12 +40,14 @@ class SDLEventReader : public QObject
     QMap<SDL_JoystickID, InputDevice *> *getJoysticks() const;
     AntiMicroSettings *getSettings() const;
     QTimer const &getPollRateTimer();
+    void setEventHandoff(SDLEventHandoff *handoff);
 
   protected:
     void initSDL();
     void closeSDL();
     void clearEvents();
     int eventStatus();
+    void handOffEvents();
 
   signals:
     void eventRaised();
@@ -56,6 +60,7 @@ class SDLEventReader : public QObject
     void stop();
     void refresh();
     void updatePollRate(int tempPollRate); // (unsigned)
+    void updateWaitForEvents(bool tempWaitForEvents);
     void resetJoystickMap();
     void quit();
     void closeDevices();
@@ -63,15 +68,23 @@ class SDLEventReader : public QObject
 
   private slots:
     void secondaryRefresh();
+    void deviceActivity();
+    void devicesChanged();
 
   private:
     QMap<SDL_JoystickID, InputDevice *> *joysticks;
     bool sdlIsOpen;
     AntiMicroSettings *settings;
     int pollRate;
+    bool waitForEvents;
     QTimer pollRateTimer;
+    SDLEventHandoff *eventHandoff;
+    SDLDeviceWatcher deviceWatcher;
+    bool deviceWatchStale;
 
     void loadSdlMappingsFromDatabase();
+    void refreshDeviceWatch();
+    int pollTimerInterval() const;
 };
 
 #endif // SDLEVENTREADER_H
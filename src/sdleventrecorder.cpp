@@ -0,0 +1,165 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sdleventrecorder.h"
+
+#include <SDL2/SDL_joystick.h>
+
+#include <QObject>
+
+const quint32 SDLEventRecorder::FILE_MAGIC = 0x414D5852; // "AMXR"
+const quint16 SDLEventRecorder::FILE_VERSION = 2;
+
+SDLEventRecorder::SDLEventRecorder()
+    : m_has_start(false)
+    , m_start_timestamp(0)
+    , m_recorded_count(0)
+{
+}
+
+SDLEventRecorder::~SDLEventRecorder() { close(); }
+
+bool SDLEventRecorder::open(const QString &fileName)
+{
+    close();
+
+    m_file.setFileName(fileName);
+
+    if (!m_file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        m_error = QObject::tr("Could not open %1 for writing: %2").arg(fileName, m_file.errorString());
+        return false;
+    }
+
+    m_stream.setDevice(&m_file);
+    m_stream.setByteOrder(QDataStream::LittleEndian);
+    m_stream.setFloatingPointPrecision(QDataStream::SinglePrecision);
+    m_stream << FILE_MAGIC << FILE_VERSION;
+
+    m_known_devices.clear();
+    m_has_start = false;
+    m_recorded_count = 0;
+    m_error.clear();
+
+    return true;
+}
+
+void SDLEventRecorder::close()
+{
+    if (!m_file.isOpen())
+        return;
+
+    m_stream.setDevice(nullptr);
+    m_file.close();
+}
+
+/**
+ * @brief Checks if the event carries controller input which can be recorded.
+ */
+bool SDLEventRecorder::isInputEvent(const SDL_Event &event)
+{
+    switch (event.type)
+    {
+    case SDL_JOYAXISMOTION:
+    case SDL_JOYBUTTONDOWN:
+    case SDL_JOYBUTTONUP:
+    case SDL_JOYHATMOTION:
+    case SDL_CONTROLLERAXISMOTION:
+    case SDL_CONTROLLERBUTTONDOWN:
+    case SDL_CONTROLLERBUTTONUP:
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+    case SDL_CONTROLLERSENSORUPDATE:
+#endif
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Appends an event to the file. Events other than controller input
+ *  are ignored.
+ */
+void SDLEventRecorder::record(const SDL_Event &event)
+{
+    if (!m_file.isOpen() || !isInputEvent(event))
+        return;
+
+    // All input event structures start with type, timestamp and instance id.
+    SDL_JoystickID which = event.jaxis.which;
+
+    if (!m_known_devices.contains(which))
+        recordDevice(which);
+
+    if (!m_has_start)
+    {
+        m_start_timestamp = event.common.timestamp;
+        m_has_start = true;
+    }
+
+    m_stream << static_cast<quint8>(EventRecord) << static_cast<quint32>(event.type)
+             << static_cast<quint32>(event.common.timestamp - m_start_timestamp) << static_cast<qint32>(which);
+
+    switch (event.type)
+    {
+    case SDL_JOYAXISMOTION:
+        m_stream << static_cast<quint8>(event.jaxis.axis) << static_cast<qint16>(event.jaxis.value);
+        break;
+    case SDL_JOYBUTTONDOWN:
+    case SDL_JOYBUTTONUP:
+        m_stream << static_cast<quint8>(event.jbutton.button) << static_cast<quint8>(event.jbutton.state);
+        break;
+    case SDL_JOYHATMOTION:
+        m_stream << static_cast<quint8>(event.jhat.hat) << static_cast<quint8>(event.jhat.value);
+        break;
+    case SDL_CONTROLLERAXISMOTION:
+        m_stream << static_cast<quint8>(event.caxis.axis) << static_cast<qint16>(event.caxis.value);
+        break;
+    case SDL_CONTROLLERBUTTONDOWN:
+    case SDL_CONTROLLERBUTTONUP:
+        m_stream << static_cast<quint8>(event.cbutton.button) << static_cast<quint8>(event.cbutton.state);
+        break;
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+    case SDL_CONTROLLERSENSORUPDATE: {
+        quint64 sensorTimestamp = 0;
+    #if SDL_VERSION_ATLEAST(2, 26, 0)
+        sensorTimestamp = event.csensor.timestamp_us;
+    #endif
+        m_stream << static_cast<qint32>(event.csensor.sensor) << event.csensor.data[0] << event.csensor.data[1]
+                 << event.csensor.data[2] << sensorTimestamp;
+        break;
+    }
+#endif
+    default:
+        break;
+    }
+
+    m_recorded_count++;
+}
+
+void SDLEventRecorder::recordDevice(SDL_JoystickID which)
+{
+    SDL_JoystickGUID guid = {};
+    SDL_Joystick *joystick = SDL_JoystickFromInstanceID(which);
+
+    if (joystick != nullptr)
+        guid = SDL_JoystickGetGUID(joystick);
+
+    m_stream << static_cast<quint8>(DeviceRecord) << static_cast<qint32>(which);
+    m_stream.writeRawData(reinterpret_cast<const char *>(guid.data), sizeof(guid.data));
+    m_known_devices.insert(which);
+}
@@ -0,0 +1,76 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <SDL2/SDL_events.h>
+
+#include <QDataStream>
+#include <QFile>
+#include <QSet>
+#include <QString>
+
+/**
+ * @brief Writes raw controller input reaching InputDaemon into a compact
+ *  binary file which can be replayed with SDLEventPlayer.
+ *
+ *  The file starts with FILE_MAGIC and FILE_VERSION followed by records.
+ *  A DeviceRecord (instance id, 16 byte SDL GUID) is written the first time
+ *  a device is seen. An EventRecord stores the event type, the time since
+ *  the first recorded event in milliseconds, the instance id and a payload
+ *  depending on the type (axis/button/hat index and value or sensor data).
+ *  Sensor data is followed by the sensor timestamp in µs, 0 if SDL does not
+ *  provide it.
+ *  Hotplug events are not recorded because replay runs against the devices
+ *  connected at that time.
+ */
+class SDLEventRecorder
+{
+  public:
+    enum RecordKind
+    {
+        DeviceRecord = 1,
+        EventRecord = 2
+    };
+
+    SDLEventRecorder();
+    ~SDLEventRecorder();
+
+    bool open(const QString &fileName);
+    void close();
+    void record(const SDL_Event &event);
+
+    inline bool isOpen() const { return m_file.isOpen(); }
+    inline quint64 getRecordedCount() const { return m_recorded_count; }
+    inline QString getErrorString() const { return m_error; }
+
+    static bool isInputEvent(const SDL_Event &event);
+
+    static const quint32 FILE_MAGIC;
+    static const quint16 FILE_VERSION;
+
+  private:
+    void recordDevice(SDL_JoystickID which);
+
+    QFile m_file;
+    QDataStream m_stream;
+    QSet<SDL_JoystickID> m_known_devices;
+    bool m_has_start;
+    Uint32 m_start_timestamp;
+    quint64 m_recorded_count;
+    QString m_error;
+};
@@ -0,0 +1,112 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sdleventring.h"
+
+#include <SDL2/SDL_error.h>
+
+#include <QDebug>
+
+const int SDLEventRing::DEFAULT_CAPACITY = 1024;
+
+SDLEventRing::SDLEventRing(int capacity)
+    : m_events(qMax(1, capacity))
+    , m_head(0)
+    , m_count(0)
+    , m_overflow_count(0)
+{
+}
+
+/**
+ * @brief Pumps SDL and moves queued events directly into the free space
+ *  of the ring using batched SDL_PeepEvents calls.
+ * @returns Number of fetched events or -1 on SDL error.
+ */
+int SDLEventRing::fetchFromSDL()
+{
+    int fetched = 0;
+    bool sdlDrained = false;
+
+    SDL_PumpEvents();
+
+    while (!isFull() && !sdlDrained)
+    {
+        // Free space can wrap around the end of the storage,
+        // so it is filled in at most two contiguous chunks.
+        int tail = position(m_count);
+        int contiguous = (tail >= m_head) ? capacity() - tail : m_head - tail;
+        int result = SDL_PeepEvents(&m_events[tail], contiguous, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+        if (result < 0)
+        {
+            qCritical() << QString("SDL Error: %1").arg(QString(SDL_GetError()));
+            return -1;
+        }
+
+        m_count += result;
+        fetched += result;
+        sdlDrained = result < contiguous;
+    }
+
+    if (isFull() && (SDL_PeepEvents(nullptr, 1, SDL_PEEKEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT) > 0))
+        m_overflow_count++;
+
+    return fetched;
+}
+
+/**
+ * @brief Appends an event at the end of the ring.
+ * @returns false when the ring is full and the event was not stored.
+ */
+bool SDLEventRing::enqueue(const SDL_Event &event)
+{
+    if (isFull())
+    {
+        m_overflow_count++;
+        return false;
+    }
+
+    m_events[position(m_count)] = event;
+    m_count++;
+
+    return true;
+}
+
+/**
+ * @brief Takes the oldest event from the ring.
+ * @returns false when the ring is empty.
+ */
+bool SDLEventRing::dequeue(SDL_Event &event)
+{
+    if (isEmpty())
+        return false;
+
+    event = m_events[m_head];
+    m_head = position(1);
+    m_count--;
+
+    if (m_count == 0)
+        m_head = 0;
+
+    return true;
+}
+
+void SDLEventRing::clear()
+{
+    m_head = 0;
+    m_count = 0;
+}
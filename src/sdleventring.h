@@ -0,0 +1,101 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <SDL2/SDL_events.h>
+
+#include <QtGlobal>
+
+#include <vector>
+
+/**
+ * @brief Fixed-capacity FIFO of SDL events reused by InputDaemon between
+ *  input cycles.
+ *  Storage is allocated once, so the ring itself does not allocate while
+ *  fetching, filtering and draining events. Events that do not fit stay in
+ *  the SDL queue and are fetched during the next cycle.
+ */
+class SDLEventRing
+{
+  public:
+    explicit SDLEventRing(int capacity = DEFAULT_CAPACITY);
+
+    int fetchFromSDL();
+    bool enqueue(const SDL_Event &event);
+    bool dequeue(SDL_Event &event);
+    void clear();
+
+    template <typename Predicate> void retainIf(Predicate keep);
+    template <typename Visitor> void forEach(Visitor visit);
+
+    inline int size() const { return m_count; }
+    inline int capacity() const { return static_cast<int>(m_events.size()); }
+    inline bool isEmpty() const { return m_count == 0; }
+    inline bool isFull() const { return m_count == capacity(); }
+    /**
+     * @brief Gets the number of fetches which left events in the SDL queue
+     *  or in the SDL thread handoff because the ring was full.
+     */
+    inline quint64 getOverflowCount() const { return m_overflow_count; }
+    inline void countOverflow() { m_overflow_count++; }
+
+    static const int DEFAULT_CAPACITY;
+
+  private:
+    inline int position(int offset) const { return (m_head + offset) % capacity(); }
+
+    std::vector<SDL_Event> m_events;
+    int m_head;
+    int m_count;
+    quint64 m_overflow_count;
+};
+
+/**
+ * @brief Removes all events for which keep returns false while preserving
+ *  the order of the remaining ones. Events are compacted in place.
+ * @param Callable taking SDL_Event& and returning bool. It may modify the event.
+ */
+template <typename Predicate> void SDLEventRing::retainIf(Predicate keep)
+{
+    int kept = 0;
+
+    for (int i = 0; i < m_count; i++)
+    {
+        SDL_Event &event = m_events[position(i)];
+
+        if (keep(event))
+        {
+            if (kept != i)
+                m_events[position(kept)] = event;
+
+            kept++;
+        }
+    }
+
+    m_count = kept;
+}
+
+/**
+ * @brief Calls visit for every queued event in FIFO order.
+ * @param Callable taking SDL_Event&. It may modify the event.
+ */
+template <typename Visitor> void SDLEventRing::forEach(Visitor visit)
+{
+    for (int i = 0; i < m_count; i++)
+        visit(m_events[position(i)]);
+}
@@ -0,0 +1,95 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QtGlobal>
+
+#include <array>
+
+/**
+ * @brief Mouse speed contributions collected between two mouse events.
+ *
+ * Entries live in a fixed array inside the object and clear() only resets
+ * the length, so collecting and consuming contributions never allocates.
+ * Index 0 is the oldest entry. Once the accumulator is full, append()
+ * overwrites the oldest entry and counts the overflow, so callers can log it.
+ */
+template <typename T, int Capacity> class SpeedAccumulator
+{
+  public:
+    SpeedAccumulator()
+        : m_first(0)
+        , m_length(0)
+        , m_overflow_count(0)
+    {
+    }
+
+    /**
+     * @return false if the accumulator was full and the oldest entry was
+     *  dropped
+     */
+    bool append(const T &value)
+    {
+        if (m_length == Capacity)
+        {
+            m_entries[m_first] = value;
+            m_first = (m_first + 1) % Capacity;
+            m_overflow_count++;
+            return false;
+        }
+
+        m_entries[(m_first + m_length) % Capacity] = value;
+        m_length++;
+        return true;
+    }
+
+    /**
+     * @brief Newest entry matching the predicate, nullptr if there is none.
+     */
+    template <typename Predicate> T *findLast(Predicate predicate)
+    {
+        for (int i = m_length - 1; i >= 0; i--)
+        {
+            T &entry = (*this)[i];
+
+            if (predicate(entry))
+                return &entry;
+        }
+
+        return nullptr;
+    }
+
+    inline void clear()
+    {
+        m_first = 0;
+        m_length = 0;
+    }
+
+    inline const T &at(int index) const { return m_entries[(m_first + index) % Capacity]; }
+    inline T &operator[](int index) { return m_entries[(m_first + index) % Capacity]; }
+    inline int length() const { return m_length; }
+    inline bool isEmpty() const { return m_length == 0; }
+    inline quint64 getOverflowCount() const { return m_overflow_count; }
+    static constexpr int capacity() { return Capacity; }
+
+  private:
+    std::array<T, Capacity> m_entries;
+    int m_first;
+    int m_length;
+    quint64 m_overflow_count;
+};
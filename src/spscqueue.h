@@ -0,0 +1,92 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Bounded lock-free queue for exactly one producer thread and one
+ *  consumer thread.
+ *  push() and freeSpace() may only be called by the producer, pop() and
+ *  clear() only by the consumer. Storage is allocated once and its size is
+ *  rounded up to a power of two.
+ */
+template <typename T> class SPSCQueue
+{
+  public:
+    explicit SPSCQueue(size_t capacity)
+        : m_buffer(roundUpPowerOfTwo(capacity))
+        , m_mask(m_buffer.size() - 1)
+        , m_head(0)
+        , m_tail(0)
+    {
+    }
+
+    bool push(const T &value)
+    {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+
+        if (tail - m_head.load(std::memory_order_acquire) == m_buffer.size())
+            return false;
+
+        m_buffer[tail & m_mask] = value;
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T &value)
+    {
+        size_t head = m_head.load(std::memory_order_relaxed);
+
+        if (head == m_tail.load(std::memory_order_acquire))
+            return false;
+
+        value = m_buffer[head & m_mask];
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    void clear() { m_head.store(m_tail.load(std::memory_order_acquire), std::memory_order_release); }
+
+    inline size_t freeSpace() const
+    {
+        return m_buffer.size() - (m_tail.load(std::memory_order_relaxed) - m_head.load(std::memory_order_acquire));
+    }
+    inline bool isEmpty() const { return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire); }
+    inline size_t capacity() const { return m_buffer.size(); }
+
+  private:
+    static size_t roundUpPowerOfTwo(size_t value)
+    {
+        size_t result = 1;
+
+        while (result < value)
+            result <<= 1;
+
+        return result;
+    }
+
+    std::vector<T> m_buffer;
+    const size_t m_mask;
+    // Keep indexes on separate cache lines so both threads do not
+    // invalidate each other's line on every operation.
+    alignas(64) std::atomic<size_t> m_head;
+    alignas(64) std::atomic<size_t> m_tail;
+};
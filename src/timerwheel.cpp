@@ -0,0 +1,381 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "timerwheel.h"
+
+#include <QThread>
+#include <QThreadStorage>
+#include <QtAlgorithms>
+
+#include <limits>
+
+static QThreadStorage<TimerWheel *> threadWheels;
+
+static inline quint64 rotateRight(quint64 value, int count)
+{
+    return (count == 0) ? value : ((value >> count) | (value << (64 - count)));
+}
+
+WheelTimer::WheelTimer()
+    : m_callback(nullptr)
+    , m_receiver(nullptr)
+    , m_wheel(nullptr)
+    , m_list(nullptr)
+    , m_prev(nullptr)
+    , m_next(nullptr)
+    , m_deadline(0)
+    , m_interval(0)
+    , m_single_shot(false)
+{
+}
+
+WheelTimer::~WheelTimer() { stop(); }
+
+/**
+ * @brief (Re)starts the timer with its current interval on the wheel of the
+ *  calling thread.
+ */
+void WheelTimer::start()
+{
+    stop();
+    TimerWheel::getInstance()->schedule(this);
+}
+
+void WheelTimer::start(int msec)
+{
+    m_interval = msec;
+    start();
+}
+
+void WheelTimer::stop()
+{
+    if (m_wheel != nullptr)
+    {
+        // Wheels are not locked, only their own thread may change them.
+        Q_ASSERT_X(QThread::currentThread() == m_wheel->thread(), "WheelTimer::stop",
+                   "Timers cannot be started or stopped from another thread");
+        m_wheel->unschedule(this);
+    }
+}
+
+TimerWheel::TimerWheel(QObject *parent)
+    : QObject(parent)
+    , m_expiring(nullptr)
+    , m_now(0)
+    , m_planned(0)
+    , m_active_count(0)
+    , m_advancing(false)
+    , m_guard(nullptr)
+{
+    for (int level = 0; level < LEVELS; level++)
+    {
+        m_slot_bits[level] = 0;
+
+        for (int index = 0; index < SLOTS; index++)
+            m_slots[level][index] = nullptr;
+    }
+
+    m_clock.start();
+
+    m_driver.setParent(this);
+    m_driver.setSingleShot(true);
+    m_driver.setTimerType(Qt::PreciseTimer);
+    connect(&m_driver, &QTimer::timeout, this, &TimerWheel::advance);
+}
+
+/**
+ * @brief Timers may outlive the thread of their wheel. They are left
+ *  inactive and can be started again in another thread.
+ */
+TimerWheel::~TimerWheel()
+{
+    auto release = [](WheelTimer *timer) {
+        while (timer != nullptr)
+        {
+            WheelTimer *next = timer->m_next;
+            timer->m_wheel = nullptr;
+            timer->m_list = nullptr;
+            timer->m_prev = nullptr;
+            timer->m_next = nullptr;
+            timer = next;
+        }
+    };
+
+    for (int level = 0; level < LEVELS; level++)
+    {
+        for (int index = 0; index < SLOTS; index++)
+            release(m_slots[level][index]);
+    }
+
+    release(m_expiring);
+}
+
+/**
+ * @brief Wheel of the calling thread. It is created on first use and
+ *  deleted when the thread finishes.
+ */
+TimerWheel *TimerWheel::getInstance()
+{
+    if (!threadWheels.hasLocalData())
+        threadWheels.setLocalData(new TimerWheel());
+
+    return threadWheels.localData();
+}
+
+/**
+ * @brief Sets the locks held while timers fire. Has to be called from the
+ *  thread of the wheel. nullptr removes the guard.
+ */
+void TimerWheel::setGuard(TimerWheelGuard *guard) { m_guard = guard; }
+
+void TimerWheel::schedule(WheelTimer *timer)
+{
+    qint64 now = m_clock.elapsed();
+
+    // Nothing has to be cascaded on an empty wheel, skip the idle time.
+    if ((m_active_count == 0) && !m_advancing && (m_now < now))
+        m_now = now;
+
+    timer->m_deadline = now + qMax(timer->m_interval, 0);
+    timer->m_wheel = this;
+    m_active_count++;
+    insert(timer);
+
+    if (!m_advancing && (!m_driver.isActive() || (timer->m_deadline < m_planned)))
+        rearmDriver();
+}
+
+void TimerWheel::unschedule(WheelTimer *timer)
+{
+    WheelTimer **list = timer->m_list;
+
+    unlink(timer);
+    timer->m_wheel = nullptr;
+    m_active_count--;
+
+    if ((list != &m_expiring) && (*list == nullptr))
+    {
+        int position = static_cast<int>(list - &m_slots[0][0]);
+        m_slot_bits[position / SLOTS] &= ~(Q_UINT64_C(1) << (position % SLOTS));
+    }
+
+    if ((m_active_count == 0) && !m_advancing)
+        m_driver.stop();
+}
+
+/**
+ * @brief Puts the timer into the lowest level whose range covers its deadline.
+ */
+void TimerWheel::insert(WheelTimer *timer)
+{
+    const qint64 range = Q_INT64_C(1) << (SLOT_BITS * LEVELS);
+    qint64 expires = timer->m_deadline;
+    int level = 0;
+
+    if (expires < m_now)
+    {
+        expires = m_now;
+    } else
+    {
+        // Deadlines out of range wait in the last level and get sorted in
+        // again when their slot is cascaded.
+        if ((expires - m_now) >= range)
+            expires = m_now + range - 1;
+
+        while ((level < (LEVELS - 1)) && ((expires - m_now) >= (Q_INT64_C(1) << (SLOT_BITS * (level + 1)))))
+            level++;
+    }
+
+    int index = static_cast<int>(expires >> (SLOT_BITS * level)) & SLOT_MASK;
+    link(&m_slots[level][index], timer);
+    m_slot_bits[level] |= Q_UINT64_C(1) << index;
+}
+
+/**
+ * @brief Sorts timers of an upper level slot into the lower levels.
+ *  Timers are moved oldest first to keep their start order.
+ */
+void TimerWheel::cascade(int level, int index)
+{
+    WheelTimer *timer = m_slots[level][index];
+
+    if (timer == nullptr)
+        return;
+
+    m_slots[level][index] = nullptr;
+    m_slot_bits[level] &= ~(Q_UINT64_C(1) << index);
+
+    while (timer->m_next != nullptr)
+        timer = timer->m_next;
+
+    while (timer != nullptr)
+    {
+        WheelTimer *prev = timer->m_prev;
+        insert(timer);
+        timer = prev;
+    }
+}
+
+/**
+ * @brief Fires all timers of the current tick. Callbacks may start and stop
+ *  any timer, including the ones still waiting to be fired.
+ */
+void TimerWheel::expire(int index)
+{
+    WheelTimer *timer = m_slots[0][index];
+
+    m_slots[0][index] = nullptr;
+    m_slot_bits[0] &= ~(Q_UINT64_C(1) << index);
+
+    // Linking to the head reverses the slot, so the oldest timer fires first.
+    while (timer != nullptr)
+    {
+        WheelTimer *next = timer->m_next;
+        link(&m_expiring, timer);
+        timer = next;
+    }
+
+    // Timers started by the callbacks belong to the next tick.
+    m_now++;
+
+    while (m_expiring != nullptr)
+    {
+        timer = m_expiring;
+        unlink(timer);
+        timer->m_wheel = nullptr;
+        m_active_count--;
+
+        if (!timer->m_single_shot)
+            schedule(timer);
+
+        if (timer->m_callback != nullptr)
+            timer->m_callback(timer->m_receiver);
+    }
+}
+
+void TimerWheel::advance()
+{
+    qint64 target = m_clock.elapsed();
+    m_advancing = true;
+
+    if (m_guard != nullptr)
+        m_guard->lockTimers();
+
+    while ((m_active_count > 0) && (m_now <= target))
+    {
+        int index = static_cast<int>(m_now & SLOT_MASK);
+
+        if (index == 0)
+        {
+            for (int level = 1; level < LEVELS; level++)
+            {
+                int levelIndex = static_cast<int>(m_now >> (SLOT_BITS * level)) & SLOT_MASK;
+                cascade(level, levelIndex);
+
+                if (levelIndex != 0)
+                    break;
+            }
+        }
+
+        quint64 pending = m_slot_bits[0] >> index;
+
+        if (pending == 0)
+        {
+            // Nothing left in this round of the first level.
+            m_now = qMin((m_now | SLOT_MASK) + 1, target + 1);
+        } else if ((pending & 1) == 0)
+        {
+            m_now = qMin(m_now + qCountTrailingZeroBits(pending), target + 1);
+        } else
+        {
+            expire(index);
+        }
+    }
+
+    if (m_guard != nullptr)
+        m_guard->unlockTimers();
+
+    m_advancing = false;
+    rearmDriver();
+}
+
+/**
+ * @brief Tick of the next slot which holds timers. For upper levels it is
+ *  the tick their slot gets cascaded at.
+ */
+qint64 TimerWheel::nextWakeup() const
+{
+    qint64 wakeup = std::numeric_limits<qint64>::max();
+
+    for (int level = 0; level < LEVELS; level++)
+    {
+        if (m_slot_bits[level] == 0)
+            continue;
+
+        int shift = SLOT_BITS * level;
+        int current = static_cast<int>(m_now >> shift) & SLOT_MASK;
+
+        // Unless the next tick starts its round, the current slot of an upper
+        // level was cascaded already and only holds timers of the next round.
+        int skipped = ((m_now & ((Q_INT64_C(1) << shift) - 1)) == 0) ? 0 : 1;
+        int first = (current + skipped) & SLOT_MASK;
+        int offset = static_cast<int>(qCountTrailingZeroBits(rotateRight(m_slot_bits[level], first))) + skipped;
+
+        wakeup = qMin(wakeup, ((m_now >> shift) + offset) << shift);
+    }
+
+    return wakeup;
+}
+
+void TimerWheel::rearmDriver()
+{
+    if (m_active_count == 0)
+    {
+        m_driver.stop();
+        return;
+    }
+
+    m_planned = nextWakeup();
+    m_driver.start(static_cast<int>(qMax(m_planned - m_clock.elapsed(), Q_INT64_C(0))));
+}
+
+void TimerWheel::link(WheelTimer **list, WheelTimer *timer)
+{
+    timer->m_list = list;
+    timer->m_prev = nullptr;
+    timer->m_next = *list;
+
+    if (*list != nullptr)
+        (*list)->m_prev = timer;
+
+    *list = timer;
+}
+
+void TimerWheel::unlink(WheelTimer *timer)
+{
+    if (timer->m_prev != nullptr)
+        timer->m_prev->m_next = timer->m_next;
+    else
+        *timer->m_list = timer->m_next;
+
+    if (timer->m_next != nullptr)
+        timer->m_next->m_prev = timer->m_prev;
+
+    timer->m_list = nullptr;
+    timer->m_prev = nullptr;
+    timer->m_next = nullptr;
+}
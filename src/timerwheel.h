@@ -0,0 +1,145 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTimer>
+
+class TimerWheel;
+
+/**
+ * @brief Lightweight replacement for QTimer which is scheduled on the
+ *  TimerWheel of the thread calling start(). It is not a QObject and
+ *  calls a member function of its receiver instead of emitting a signal.
+ *  Like QTimer it has to be started and stopped from the thread it runs in.
+ */
+class WheelTimer
+{
+  public:
+    WheelTimer();
+    ~WheelTimer();
+
+    template <class T, void (T::*Slot)()> void setCallback(T *receiver)
+    {
+        m_callback = &invokeSlot<T, Slot>;
+        m_receiver = receiver;
+    }
+
+    void start();
+    void start(int msec);
+    void stop();
+
+    inline bool isActive() const { return m_wheel != nullptr; }
+    inline int interval() const { return m_interval; }
+    inline void setInterval(int msec) { m_interval = msec; }
+    inline bool isSingleShot() const { return m_single_shot; }
+    inline void setSingleShot(bool singleShot) { m_single_shot = singleShot; }
+
+  private:
+    friend class TimerWheel;
+
+    Q_DISABLE_COPY(WheelTimer)
+
+    template <class T, void (T::*Slot)()> static void invokeSlot(void *receiver) { (static_cast<T *>(receiver)->*Slot)(); }
+
+    void (*m_callback)(void *);
+    void *m_receiver;
+
+    TimerWheel *m_wheel;
+    WheelTimer **m_list;
+    WheelTimer *m_prev;
+    WheelTimer *m_next;
+    qint64 m_deadline;
+    int m_interval;
+    bool m_single_shot;
+};
+
+/**
+ * @brief Locks taken around the callbacks of a TimerWheel. Threads whose
+ *  timers touch state shared with other threads install one with
+ *  TimerWheel::setGuard().
+ */
+class TimerWheelGuard
+{
+  public:
+    virtual ~TimerWheelGuard() = default;
+
+    virtual void lockTimers() = 0;
+    virtual void unlockTimers() = 0;
+};
+
+/**
+ * @brief Hierarchical timer wheel with millisecond resolution shared by all
+ *  WheelTimer instances of one thread.
+ *  Four levels of 64 slots cover deadlines up to about 4.6 hours, longer ones
+ *  are cascaded again once they come into range. Starting and stopping a
+ *  timer is O(1) and only one QTimer per thread is used to wake up at the
+ *  next slot which holds timers.
+ */
+class TimerWheel : public QObject
+{
+    Q_OBJECT
+
+  public:
+    ~TimerWheel();
+
+    static TimerWheel *getInstance();
+
+    inline int getActiveCount() const { return m_active_count; }
+    void setGuard(TimerWheelGuard *guard);
+
+  private slots:
+    void advance();
+
+  private:
+    explicit TimerWheel(QObject *parent = nullptr);
+
+    friend class WheelTimer;
+
+    void schedule(WheelTimer *timer);
+    void unschedule(WheelTimer *timer);
+    void insert(WheelTimer *timer);
+    void cascade(int level, int index);
+    void expire(int index);
+    qint64 nextWakeup() const;
+    void rearmDriver();
+
+    static void link(WheelTimer **list, WheelTimer *timer);
+    static void unlink(WheelTimer *timer);
+
+    static const int LEVELS = 4;
+    static const int SLOT_BITS = 6;
+    static const int SLOTS = 1 << SLOT_BITS;
+    static const int SLOT_MASK = SLOTS - 1;
+
+    WheelTimer *m_slots[LEVELS][SLOTS];
+    quint64 m_slot_bits[LEVELS];
+    WheelTimer *m_expiring;
+
+    QElapsedTimer m_clock;
+    QTimer m_driver;
+    qint64 m_now;       ///< next tick to process
+    qint64 m_planned;   ///< tick the driver is going to wake up at
+    int m_active_count;
+    bool m_advancing;
+    TimerWheelGuard *m_guard;
+};
+
+#endif // TIMERWHEEL_H
@@ -27,6 +27,7 @@
 #include "xmlconfigwriter.h"
 
 #include <QDebug>
+#include <QSharedPointer>
 
 JoyTabWidgetHelper::JoyTabWidgetHelper(InputDevice *device, QObject *parent)
     : QObject(parent)
@@ -105,7 +106,27 @@ bool JoyTabWidgetHelper::readConfigFileWithRevert(QString filepath)
 }
 
 /**
- * @brief XML write entry point for the GUI
+ * @brief XML write entry point for the GUI. Returns right away, the profile
+ *  is serialized in the thread of the device and failures are reported
+ *  through writeFailed(). Has to be called from the GUI thread.
+ */
+void JoyTabWidgetHelper::scheduleWriteConfigFile(QString filepath)
+{
+    // Released when the save ran or was dropped with this helper.
+    QSharedPointer<XMLConfigWriter::ScheduledWrite> scheduled(new XMLConfigWriter::ScheduledWrite);
+
+    QMetaObject::invokeMethod(
+        this,
+        [this, filepath, scheduled] {
+            if (!writeConfigFile(filepath))
+                emit writeFailed(filepath);
+        },
+        Qt::QueuedConnection);
+}
+
+/**
+ * @brief Serializes the profile and writes it in the background.
+ *  Runs in the thread of the device.
  */
 bool JoyTabWidgetHelper::writeConfigFile(QString filepath)
 {
@@ -113,17 +134,22 @@ bool JoyTabWidgetHelper::writeConfigFile(QString filepath)
 
     if (this->writer != nullptr)
     {
-        this->writer->deleteLater();
+        this->writer->deleteWhenFinished();
         this->writer = nullptr;
     }
 
     this->writer = new XMLConfigWriter;
+    connect(this->writer, &XMLConfigWriter::writeFailed, this, &JoyTabWidgetHelper::writeFailed);
     this->writer->setFileName(filepath);
     InputDeviceXml *deviceXml = new InputDeviceXml(device);
     this->writer->write(deviceXml);
     delete deviceXml;
 
     result = !this->writer->hasError();
+
+    if (!result)
+        WARN() << this->writer->getErrorString();
+
     return result;
 }
 
@@ -42,6 +42,8 @@ class JoyTabWidgetHelper : public QObject
     bool hasError();
     QString getErrorString();
 
+    void scheduleWriteConfigFile(QString filepath);
+
   protected:
     InputDevice *device;
     XMLConfigReader *reader;
@@ -49,6 +51,9 @@ class JoyTabWidgetHelper : public QObject
     bool errorOccurred;
     QString lastErrorString;
 
+  signals:
+    void writeFailed(QString filepath);
+
   public slots:
     bool readConfigFile(QString filepath);
     bool readConfigFileWithRevert(QString filepath);
@@ -22,6 +22,7 @@
 
 #include <X11/XKBlib.h>
 #include <X11/Xatom.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include <QDebug>
@@ -37,6 +38,8 @@ X11Extras *X11Extras::_instance = nullptr;
 X11Extras::X11Extras(QObject *parent)
     : QObject(parent)
     , knownAliases()
+    , windowCacheHits(0)
+    , windowCacheMisses(0)
 {
     _display = XOpenDisplay(nullptr);
     populateKnownAliases();
@@ -48,6 +51,7 @@ X11Extras::X11Extras(QObject *parent)
  */
 X11Extras::~X11Extras()
 {
+    qDebug() << "Window cache hits:" << windowCacheHits << "misses:" << windowCacheMisses;
     freeDisplay();
     _instance = nullptr;
 }
@@ -63,6 +67,9 @@ template <typename T> void freeWindow(T *window)
 
 void X11Extras::freeDisplay()
 {
+    windowCache.clear();
+    pidWindows.clear();
+
     if (_display != nullptr)
     {
         XCloseDisplay(_display);
@@ -240,7 +247,7 @@ Window X11Extras::findParentClient(Window window)
  * @param Window XID for window of interest
  * @return PID of the application instance corresponding to the window
  */
-int X11Extras::getApplicationPid(Window window)
+int X11Extras::queryApplicationPid(Window window)
 {
     Atom atom, actual_type;
     int actual_format = 0;
@@ -333,7 +340,7 @@ void X11Extras::checkPropertyOnWin(bool windowCorrected, Window &window, Window
  * @param PID of window
  * @return File location of application
  */
-QString X11Extras::getApplicationLocation(int pid)
+QString X11Extras::queryApplicationLocation(int pid)
 {
     QString exepath = QString();
 
@@ -483,7 +490,7 @@ bool X11Extras::isWindowRelevant(Display *display, Window window)
     return result;
 }
 
-QString X11Extras::getWindowTitle(Window window)
+QString X11Extras::queryWindowTitle(Window window)
 {
     QString temp = QString();
 
@@ -533,7 +540,7 @@ QString X11Extras::getWindowTitle(Window window)
     return temp;
 }
 
-QString X11Extras::getWindowClass(Window window)
+QString X11Extras::queryWindowClass(Window window)
 {
     QString temp = QString();
 
@@ -571,6 +578,229 @@ QString X11Extras::getWindowClass(Window window)
     return temp;
 }
 
+/**
+ * @brief Change time of /proc/<pid>. It differs when the pid was reused by
+ *  another process.
+ */
+static qint64 procChangeTime(int pid)
+{
+    struct stat procStat;
+    QByteArray procPath = QByteArray("/proc/") + QByteArray::number(pid);
+
+    if (stat(procPath.constData(), &procStat) != 0)
+        return -1;
+
+    return static_cast<qint64>(procStat.st_ctim.tv_sec) * 1000000000 + procStat.st_ctim.tv_nsec;
+}
+
+/**
+ * @brief Returns the cache entry of a window and creates it if needed.
+ *  Events are selected before any property is read so no change between
+ *  reading and caching a value can be missed.
+ * @return nullptr for invalid windows or without display
+ */
+X11Extras::CachedWindow *X11Extras::cachedWindow(Window window)
+{
+    if ((window == None) || (_display == nullptr))
+        return nullptr;
+
+    auto iter = windowCache.find(window);
+
+    if (iter == windowCache.end())
+    {
+        if (windowCache.size() >= MAX_CACHED_WINDOWS)
+            clearWindowCache();
+
+        XSelectInput(_display, window, PropertyChangeMask | StructureNotifyMask);
+        iter = windowCache.insert(window, CachedWindow{0, -1, QString(), QString(), QString(), 0});
+    }
+
+    return &iter.value();
+}
+
+/**
+ * @brief Drops cached values which were invalidated by window events.
+ *  Nothing else reads events from this connection.
+ */
+void X11Extras::processWindowCacheEvents()
+{
+    if (windowCache.isEmpty() || (_display == nullptr))
+        return;
+
+    Atom wm_name = XA_WM_NAME;
+    Atom net_wm_name = XInternAtom(_display, "_NET_WM_NAME", True);
+    Atom wm_class = XA_WM_CLASS;
+    Atom net_wm_pid = XInternAtom(_display, "_NET_WM_PID", True);
+
+    while (XPending(_display) > 0)
+    {
+        XEvent event;
+        XNextEvent(_display, &event);
+
+        if (event.type == DestroyNotify)
+        {
+            Window window = event.xdestroywindow.window;
+            auto iter = windowCache.find(window);
+
+            if (iter != windowCache.end())
+            {
+                if (pidWindows.value(iter.value().pid, None) == window)
+                    pidWindows.remove(iter.value().pid);
+
+                windowCache.erase(iter);
+            }
+        } else if (event.type == PropertyNotify)
+        {
+            auto iter = windowCache.find(event.xproperty.window);
+
+            if (iter == windowCache.end())
+                continue;
+
+            if ((event.xproperty.atom == wm_name) || (event.xproperty.atom == net_wm_name))
+                iter.value().validFields &= ~CACHED_TITLE;
+            else if (event.xproperty.atom == wm_class)
+                iter.value().validFields &= ~CACHED_CLASS;
+            else if (event.xproperty.atom == net_wm_pid)
+                iter.value().validFields &= ~(CACHED_PID | CACHED_EXE);
+        }
+    }
+}
+
+/**
+ * @brief Events of windows which are no longer cached are ignored, their
+ *  input selection is kept because they might be gone already.
+ */
+void X11Extras::clearWindowCache()
+{
+    windowCache.clear();
+    pidWindows.clear();
+}
+
+/**
+ * @brief Cached variant of queryApplicationPid(). Valid until the window is
+ *  destroyed or its _NET_WM_PID changes.
+ */
+int X11Extras::getApplicationPid(Window window)
+{
+    processWindowCacheEvents();
+    CachedWindow *entry = cachedWindow(window);
+
+    if ((entry != nullptr) && (entry->validFields & CACHED_PID))
+    {
+        windowCacheHits++;
+        return entry->pid;
+    }
+
+    windowCacheMisses++;
+    int pid = queryApplicationPid(window);
+
+    if (entry != nullptr)
+    {
+        if (pidWindows.value(entry->pid, None) == window)
+            pidWindows.remove(entry->pid);
+
+        entry->pid = pid;
+        entry->validFields = (entry->validFields & ~CACHED_EXE) | CACHED_PID;
+
+        if (pid > 0)
+            pidWindows.insert(pid, window);
+    }
+
+    return pid;
+}
+
+/**
+ * @brief Cached variant of queryApplicationLocation(). Only pids returned by
+ *  getApplicationPid() are cached, together with their window.
+ */
+QString X11Extras::getApplicationLocation(int pid)
+{
+    processWindowCacheEvents();
+
+    Window window = pidWindows.value(pid, None);
+    CachedWindow *entry = nullptr;
+
+    if (window != None)
+    {
+        auto iter = windowCache.find(window);
+
+        if (iter != windowCache.end())
+            entry = &iter.value();
+    }
+
+    qint64 stamp = (entry != nullptr) ? procChangeTime(pid) : -1;
+
+    if ((entry != nullptr) && (entry->validFields & CACHED_EXE) && (stamp != -1) && (entry->procStamp == stamp))
+    {
+        windowCacheHits++;
+        return entry->exePath;
+    }
+
+    windowCacheMisses++;
+    QString exepath = queryApplicationLocation(pid);
+
+    if (entry != nullptr)
+    {
+        entry->exePath = exepath;
+        entry->procStamp = stamp;
+        entry->validFields |= CACHED_EXE;
+    }
+
+    return exepath;
+}
+
+/**
+ * @brief Title of a window. Cached until the title changes.
+ */
+QString X11Extras::getWindowTitle(Window window)
+{
+    processWindowCacheEvents();
+    CachedWindow *entry = cachedWindow(window);
+
+    if ((entry != nullptr) && (entry->validFields & CACHED_TITLE))
+    {
+        windowCacheHits++;
+        return entry->title;
+    }
+
+    windowCacheMisses++;
+    QString title = queryWindowTitle(window);
+
+    if (entry != nullptr)
+    {
+        entry->title = title;
+        entry->validFields |= CACHED_TITLE;
+    }
+
+    return title;
+}
+
+/**
+ * @brief WM_CLASS of a window. Cached until the class changes.
+ */
+QString X11Extras::getWindowClass(Window window)
+{
+    processWindowCacheEvents();
+    CachedWindow *entry = cachedWindow(window);
+
+    if ((entry != nullptr) && (entry->validFields & CACHED_CLASS))
+    {
+        windowCacheHits++;
+        return entry->windowClass;
+    }
+
+    windowCacheMisses++;
+    QString windowClass = queryWindowClass(window);
+
+    if (entry != nullptr)
+    {
+        entry->windowClass = windowClass;
+        entry->validFields |= CACHED_CLASS;
+    }
+
+    return windowClass;
+}
+
 unsigned long X11Extras::getWindowInFocus()
 {
     unsigned long result = 0;
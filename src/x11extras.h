@@ -78,6 +78,9 @@ class X11Extras : public QObject
 
     QHash<QString, QString> const &getKnownAliases();
 
+    inline quint64 getWindowCacheHits() const { return windowCacheHits; }
+    inline quint64 getWindowCacheMisses() const { return windowCacheMisses; }
+
   protected:
     explicit X11Extras(QObject *parent = nullptr);
 
@@ -99,8 +102,46 @@ class X11Extras : public QObject
     void findVirtualPtr(int num_devices, XIDeviceInfo *current_devices, XIDeviceInfo *mouse_device,
                         XIDeviceInfo *all_devices, QString pointerName);
 
+    int queryApplicationPid(Window window);
+    QString queryApplicationLocation(int pid);
+    QString queryWindowTitle(Window window);
+    QString queryWindowClass(Window window);
+
+    enum CachedWindowField
+    {
+        CACHED_PID = 0x1,
+        CACHED_EXE = 0x2,
+        CACHED_CLASS = 0x4,
+        CACHED_TITLE = 0x8
+    };
+
+    /**
+     * @brief Properties of a window which were already looked up.
+     *  Entries are dropped on DestroyNotify, single fields are dropped
+     *  when the matching property changes.
+     */
+    struct CachedWindow
+    {
+        int pid;
+        qint64 procStamp; ///< change time of /proc/<pid>, detects pid reuse
+        QString exePath;
+        QString windowClass;
+        QString title;
+        int validFields;
+    };
+
+    CachedWindow *cachedWindow(Window window);
+    void processWindowCacheEvents();
+    void clearWindowCache();
+
+    static const int MAX_CACHED_WINDOWS = 256;
+
     QHash<QString, QString> knownAliases;
     Display *_display;
+    QHash<Window, CachedWindow> windowCache;
+    QHash<int, Window> pidWindows;
+    quint64 windowCacheHits;
+    quint64 windowCacheMisses;
 };
 
 #endif // X11EXTRAS_H
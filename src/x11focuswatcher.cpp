@@ -0,0 +1,230 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "x11focuswatcher.h"
+
+#include <X11/Xatom.h>
+
+#include <QDebug>
+#include <QSocketNotifier>
+#include <QTimer>
+
+static Display *watcherDisplay = nullptr;
+static XErrorHandler previousErrorHandler = nullptr;
+
+/**
+ * @brief Watched windows may be destroyed at any time. Errors caused by them
+ *  are ignored, errors of other connections go to the previous handler.
+ */
+static int ignoreWatcherErrors(Display *display, XErrorEvent *error)
+{
+    if (display == watcherDisplay)
+        return 0;
+
+    return (previousErrorHandler != nullptr) ? previousErrorHandler(display, error) : 0;
+}
+
+X11FocusWatcher::X11FocusWatcher(QObject *parent)
+    : QObject(parent)
+    , m_display(nullptr)
+    , m_notifier(nullptr)
+    , m_root(None)
+    , m_active_window(None)
+    , m_net_active_window(None)
+    , m_net_wm_name(None)
+    , m_wm_name(None)
+{
+}
+
+X11FocusWatcher::~X11FocusWatcher() { stop(); }
+
+/**
+ * @brief Opens the connection and starts watching.
+ * @returns false if the X server cannot be reached or the window manager
+ *  does not publish the active window. Polling has to be used then.
+ */
+bool X11FocusWatcher::start()
+{
+    if (isActive())
+        return true;
+
+    m_display = XOpenDisplay(nullptr);
+
+    if (m_display == nullptr)
+        return false;
+
+    watcherDisplay = m_display;
+
+    if (previousErrorHandler == nullptr)
+        previousErrorHandler = XSetErrorHandler(ignoreWatcherErrors);
+
+    m_root = DefaultRootWindow(m_display);
+    m_net_active_window = XInternAtom(m_display, "_NET_ACTIVE_WINDOW", True);
+    m_net_wm_name = XInternAtom(m_display, "_NET_WM_NAME", False);
+    m_wm_name = XA_WM_NAME;
+
+    Atom actualType = None;
+    int actualFormat = 0;
+    unsigned long nitems = 0;
+    unsigned long bytesAfter = 0;
+    unsigned char *prop = nullptr;
+
+    bool supported = (m_net_active_window != None) &&
+                     (XGetWindowProperty(m_display, m_root, m_net_active_window, 0, 1, False, XA_WINDOW, &actualType,
+                                         &actualFormat, &nitems, &bytesAfter, &prop) == Success) &&
+                     (actualType == XA_WINDOW);
+
+    if (prop != nullptr)
+        XFree(prop);
+
+    if (!supported)
+    {
+        qDebug() << "Window manager does not publish _NET_ACTIVE_WINDOW";
+        stop();
+        return false;
+    }
+
+    XSelectInput(m_display, m_root, PropertyChangeMask);
+    watchActiveWindow();
+    XFlush(m_display);
+
+    m_notifier = new QSocketNotifier(ConnectionNumber(m_display), QSocketNotifier::Read, this);
+    connect(m_notifier, &QSocketNotifier::activated, this, &X11FocusWatcher::readEvents);
+
+    // Reading the active window may have queued events already taken off
+    // the socket, the notifier does not fire for them.
+    if (XEventsQueued(m_display, QueuedAlready) > 0)
+        QTimer::singleShot(0, this, &X11FocusWatcher::readEvents);
+
+    return true;
+}
+
+void X11FocusWatcher::stop()
+{
+    if (m_notifier != nullptr)
+    {
+        delete m_notifier;
+        m_notifier = nullptr;
+    }
+
+    if (m_display != nullptr)
+    {
+        if (watcherDisplay == m_display)
+            watcherDisplay = nullptr;
+
+        XCloseDisplay(m_display);
+        m_display = nullptr;
+    }
+
+    m_active_window = None;
+}
+
+bool X11FocusWatcher::isActive() const { return m_notifier != nullptr; }
+
+/**
+ * @brief Drains all queued events and reports each kind of change once.
+ *  Reading the new active window is a round trip which can queue more
+ *  events inside Xlib. The notifier never fires for those, so they are
+ *  drained here as well.
+ */
+void X11FocusWatcher::readEvents()
+{
+    if (m_display == nullptr)
+        return;
+
+    bool activeChanged = false;
+    bool titleChanged = false;
+
+    do
+    {
+        bool activeChangedNow = false;
+
+        while (XPending(m_display) > 0)
+        {
+            XEvent event;
+            XNextEvent(m_display, &event);
+
+            if (event.type != PropertyNotify)
+                continue;
+
+            if ((event.xproperty.window == m_root) && (event.xproperty.atom == m_net_active_window))
+            {
+                activeChangedNow = true;
+            } else if ((event.xproperty.window == m_active_window) &&
+                       ((event.xproperty.atom == m_net_wm_name) || (event.xproperty.atom == m_wm_name)))
+            {
+                titleChanged = true;
+            }
+        }
+
+        if (activeChangedNow)
+        {
+            activeChanged = true;
+            watchActiveWindow();
+            XFlush(m_display);
+        }
+    } while (XEventsQueued(m_display, QueuedAlready) > 0);
+
+    if (activeChanged)
+    {
+        emit activeWindowChanged();
+    } else if (titleChanged)
+    {
+        emit activeWindowTitleChanged();
+    }
+}
+
+Window X11FocusWatcher::readActiveWindow()
+{
+    Window result = None;
+    Atom actualType = None;
+    int actualFormat = 0;
+    unsigned long nitems = 0;
+    unsigned long bytesAfter = 0;
+    unsigned char *prop = nullptr;
+
+    int status = XGetWindowProperty(m_display, m_root, m_net_active_window, 0, 1, False, XA_WINDOW, &actualType,
+                                    &actualFormat, &nitems, &bytesAfter, &prop);
+
+    if ((status == Success) && (prop != nullptr) && (nitems > 0))
+        result = *reinterpret_cast<Window *>(prop);
+
+    if (prop != nullptr)
+        XFree(prop);
+
+    return result;
+}
+
+/**
+ * @brief Moves the title watch from the previously active window to the
+ *  current one.
+ */
+void X11FocusWatcher::watchActiveWindow()
+{
+    Window activeWindow = readActiveWindow();
+
+    if (activeWindow == m_active_window)
+        return;
+
+    if ((m_active_window != None) && (m_active_window != m_root))
+        XSelectInput(m_display, m_active_window, NoEventMask);
+
+    m_active_window = activeWindow;
+
+    if ((m_active_window != None) && (m_active_window != m_root))
+        XSelectInput(m_display, m_active_window, PropertyChangeMask);
+}
@@ -0,0 +1,68 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef X11FOCUSWATCHER_H
+#define X11FOCUSWATCHER_H
+
+#include <QObject>
+
+#include <X11/Xlib.h>
+
+class QSocketNotifier;
+
+/**
+ * @brief Reports changes of the active window and of its title using
+ *  PropertyNotify events instead of polling the X server.
+ *
+ * _NET_ACTIVE_WINDOW is watched on the root window and _NET_WM_NAME/WM_NAME
+ * on the currently active window. A private display connection is used so
+ * that no other code reads or discards these events. Requires a window
+ * manager which maintains _NET_ACTIVE_WINDOW.
+ */
+class X11FocusWatcher : public QObject
+{
+    Q_OBJECT
+
+  public:
+    explicit X11FocusWatcher(QObject *parent = nullptr);
+    ~X11FocusWatcher();
+
+    bool start();
+    void stop();
+    bool isActive() const;
+
+  signals:
+    void activeWindowChanged();
+    void activeWindowTitleChanged();
+
+  private slots:
+    void readEvents();
+
+  private:
+    Window readActiveWindow();
+    void watchActiveWindow();
+
+    Display *m_display;
+    QSocketNotifier *m_notifier;
+    Window m_root;
+    Window m_active_window;
+    Atom m_net_active_window;
+    Atom m_net_wm_name;
+    Atom m_wm_name;
+};
+
+#endif // X11FOCUSWATCHER_H
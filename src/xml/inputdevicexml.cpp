@@ -28,6 +28,7 @@
 #include "logger.h"
 
 #include <QDebug>
+#include <QThread>
 #include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 
@@ -37,29 +38,67 @@ InputDeviceXml::InputDeviceXml(InputDevice *inputDevice, QObject *parent)
 {
     QThread *thread = m_inputDevice->thread();
     this->moveToThread(thread);
-    connect(this, &InputDeviceXml::readConfigSig, this, &InputDeviceXml::readConfig);
 }
 
 /**
- * @brief Deserializes the given XML stream into an InputDevice object
+ * @brief Deserializes the given XML stream into an InputDevice object.
+ *  Reading runs on the thread owning the device. A caller on another
+ *  thread is blocked until it is done and does not touch the stream
+ *  meanwhile. Afterwards the stream is positioned at the end of the device
+ *  element.
  * @param[in] xml The XML stream to read from
  */
 void InputDeviceXml::readConfig(QXmlStreamReader *xml)
 {
-    m_mutex_read_config.try_lock();
-    // reading of config should be handled in inputEventThread
-    if (this->thread() != QThread::currentThread())
+    if (isOwnerThread())
     {
-        emit readConfigSig(xml);
-        DEBUG() << "Redirecting readConfig call to antoher Thread, waiting on mutex here.";
-        bool opened = m_mutex_read_config.tryLock(1000);
-        if (opened)
-            DEBUG() << "readConfig mutex opened";
-        else
-            WARN() << "Could not open mutex_read_config";
-        m_mutex_read_config.unlock();
+        readDeviceConfig(xml);
         return;
     }
+
+    DEBUG() << "Reading profile in thread of" << m_inputDevice->getSDLName();
+    QMetaObject::invokeMethod(
+        this, [this, xml] { readDeviceConfig(xml); }, Qt::BlockingQueuedConnection);
+}
+
+/**
+ * @brief Reads a preloaded or cached profile document into the InputDevice
+ *  on the thread owning it. Blocks the calling thread until it was read.
+ * @return error message of the reader, empty on success
+ */
+QString InputDeviceXml::applyConfig(const QByteArray &deviceXml)
+{
+    QString error;
+
+    if (!isOwnerThread())
+    {
+        DEBUG() << "Applying profile in thread of" << m_inputDevice->getSDLName();
+        QMetaObject::invokeMethod(
+            this, [this, &deviceXml, &error] { error = applyConfig(deviceXml); }, Qt::BlockingQueuedConnection);
+        return error;
+    }
+
+    QXmlStreamReader reader(deviceXml);
+    reader.readNextStartElement();
+    readDeviceConfig(&reader);
+
+    if (reader.hasError() && (reader.error() != QXmlStreamReader::PrematureEndOfDocumentError))
+        error = reader.errorString();
+
+    return error;
+}
+
+/**
+ * @brief Reading can run directly when the device thread is the current
+ *  one or when it is not running (yet or anymore).
+ */
+bool InputDeviceXml::isOwnerThread() const
+{
+    return (thread() == QThread::currentThread()) || !thread()->isRunning();
+}
+
+void InputDeviceXml::readDeviceConfig(QXmlStreamReader *xml)
+{
     if (xml->isStartElement() && (xml->name().toString() == m_inputDevice->getXmlName()))
     {
         m_inputDevice->transferReset();
@@ -371,7 +410,6 @@ void InputDeviceXml::readConfig(QXmlStreamReader *xml)
 
         m_inputDevice->reInitButtons();
     }
-    m_mutex_read_config.unlock();
 }
 
 /**
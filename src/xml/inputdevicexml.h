@@ -18,7 +18,7 @@
 #ifndef INPUTDEVICEXML_H
 #define INPUTDEVICEXML_H
 
-#include <QMutex>
+#include <QByteArray>
 #include <QObject>
 
 class QXmlStreamReader;
@@ -33,6 +33,10 @@ class AntiMicroSettings;
  *
  *  After serializing or deserializing the device data, it reads/writes
  *  all SetJoysticks.
+ *
+ *  Reading always runs on the thread owning the InputDevice because it
+ *  creates and changes its QObjects. A caller on another thread waits until
+ *  reading is done, so the stream is only used by one thread at a time.
  */
 class InputDeviceXml : public QObject
 {
@@ -40,19 +44,18 @@ class InputDeviceXml : public QObject
   public:
     explicit InputDeviceXml(InputDevice *inputDevice, QObject *parent = nullptr);
 
+    QString applyConfig(const QByteArray &deviceXml);
+
   public slots:
 
     void readConfig(QXmlStreamReader *xml);  // InputDeviceXml class
     void writeConfig(QXmlStreamWriter *xml); // InputDeviceXml class
 
-  signals:
-    void readConfigSig(QXmlStreamReader *xml);
-
   private:
-    InputDevice *m_inputDevice;
+    bool isOwnerThread() const;
+    void readDeviceConfig(QXmlStreamReader *xml);
 
-    // ensures that readConfig returns when reading is finished even for reading in different thread
-    QMutex m_mutex_read_config;
+    InputDevice *m_inputDevice;
 };
 
 #endif // INPUTDEVICEXML_H
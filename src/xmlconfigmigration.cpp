@@ -22,8 +22,14 @@
 #include "common.h"
 #include "event.h"
 #include "eventhandlerfactory.h"
+#include "globalvariables.h"
+#include "logger.h"
+#include "xmlconfigwriter.h"
 
+#include <QBuffer>
 #include <QDebug>
+#include <QFile>
+#include <QFileInfo>
 #include <QXmlStreamReader>
 #include <QXmlStreamWriter>
 
@@ -53,53 +59,77 @@ bool XMLConfigMigration::requiresMigration()
     return toMigrate;
 }
 
-QString XMLConfigMigration::migrate()
+/**
+ * @brief Streams the migrated profile to the given device. The reader has to
+ *  be positioned at the root element and is consumed completely.
+ * @return false if no migration was needed or the source could not be parsed
+ */
+bool XMLConfigMigration::migrate(QIODevice *output)
 {
-    QString tempXmlString = QString();
+    if (!requiresMigration())
+        return false;
 
-    if (requiresMigration())
-    {
-        QString initialData = readConfigToString();
-        reader->clear();
-        reader->addData(initialData);
+    QXmlStreamWriter writer(output);
+    writer.setAutoFormatting(true);
 
-        if ((fileVersion >= 2) && (fileVersion <= 5))
-        {
-            tempXmlString = version0006Migration();
-            fileVersion = PadderCommon::LATESTCONFIGFILEVERSION;
-        }
+    if ((fileVersion >= 2) && (fileVersion <= 5))
+    {
+        version0006Migration(&writer);
+        fileVersion = PadderCommon::LATESTCONFIGFILEVERSION;
     }
 
-    return tempXmlString;
+    return !reader->hasError() && !writer.hasError();
 }
 
-QString XMLConfigMigration::readConfigToString()
+/**
+ * @brief Migrates a profile file in place if needed. The file is replaced
+ *  atomically by the profile writer thread, so readers see either the old
+ *  or the complete new profile and a save made in the meantime is kept.
+ *  Can be called from any thread but the writer thread.
+ * @return true if the file needed migration
+ */
+bool XMLConfigMigration::migrateFile(const QString &fileName)
 {
-    QString tempXmlString = QString();
-    QXmlStreamWriter writer(&tempXmlString);
-    writer.setAutoFormatting(true);
+    QFileInfo fileInfo(fileName);
+    qint64 size = fileInfo.size();
+    QDateTime lastModified = fileInfo.lastModified();
+    QFile file(fileName);
 
-    while (!reader->atEnd())
-    {
-        writer.writeCurrentToken(*reader);
-        reader->readNext();
-    }
+    if (!file.open(QFile::ReadOnly | QFile::Text))
+        return false;
+
+    QXmlStreamReader reader(&file);
+    reader.readNextStartElement();
+
+    if (reader.name() != GlobalVariables::Joystick::xmlName)
+        return false;
+
+    XMLConfigMigration migration(&reader);
+
+    if (!migration.requiresMigration())
+        return false;
 
-    return tempXmlString;
+    QByteArray migrated;
+    QBuffer output(&migrated);
+    output.open(QIODevice::WriteOnly);
+
+    if (!migration.migrate(&output))
+        return false;
+
+    file.close();
+    XMLConfigWriter::replaceUnmodified(fileName, migrated, size, lastModified);
+    XMLConfigWriter::waitForPendingWrites(fileName);
+    return true;
 }
 
-QString XMLConfigMigration::version0006Migration()
+void XMLConfigMigration::version0006Migration(QXmlStreamWriter *writer)
 {
-    QString tempXmlString = QString();
-    QXmlStreamWriter writer(&tempXmlString);
-    writer.setAutoFormatting(true);
-    reader->readNextStartElement();
     reader->readNextStartElement();
 
-    writer.writeStartDocument();
-    writer.writeStartElement("joystick");
-    writer.writeAttribute("configversion", QString::number(6));
-    writer.writeAttribute("appversion", PadderCommon::programVersion);
+    writer->writeStartDocument();
+    writer->writeStartElement("joystick");
+    writer->writeAttribute("configversion", QString::number(6));
+    writer->writeAttribute("appversion", PadderCommon::programVersion);
 
     while (!reader->atEnd())
     {
@@ -107,7 +137,7 @@ QString XMLConfigMigration::version0006Migration()
         {
             int slotcode = 0;
             QString slotmode = QString();
-            writer.writeCurrentToken(*reader);
+            writer->writeCurrentToken(*reader);
             reader->readNext();
 
             // Grab current slot code and slot mode
@@ -122,7 +152,7 @@ QString XMLConfigMigration::version0006Migration()
                     slotmode = reader->readElementText();
                 } else
                 {
-                    writer.writeCurrentToken(*reader);
+                    writer->writeCurrentToken(*reader);
                 }
 
                 reader->readNext();
@@ -151,30 +181,28 @@ QString XMLConfigMigration::version0006Migration()
 #endif
                     if (slotcode > 0)
                     {
-                        writer.writeTextElement("code", QString("0x%1").arg(slotcode, 0, 16));
+                        writer->writeTextElement("code", QString("0x%1").arg(slotcode, 0, 16));
                     } else if (tempcode > 0)
                     {
-                        writer.writeTextElement("code",
-                                                QString("0x%1").arg(tempcode | QtKeyMapperBase::nativeKeyPrefix, 0, 16));
+                        writer->writeTextElement("code",
+                                                 QString("0x%1").arg(tempcode | QtKeyMapperBase::nativeKeyPrefix, 0, 16));
                     }
                 } else
                 {
-                    writer.writeTextElement("code", QString::number(slotcode));
+                    writer->writeTextElement("code", QString::number(slotcode));
                 }
 
-                writer.writeTextElement("mode", slotmode);
+                writer->writeTextElement("mode", slotmode);
             }
 
-            writer.writeCurrentToken(*reader);
+            writer->writeCurrentToken(*reader);
         } else
         {
-            writer.writeCurrentToken(*reader);
+            writer->writeCurrentToken(*reader);
         }
 
         reader->readNext();
     }
-
-    return tempXmlString;
 }
 
 const QXmlStreamReader *XMLConfigMigration::getReader() { return reader; }
@@ -21,8 +21,15 @@
 
 #include <QObject>
 
+class QIODevice;
 class QXmlStreamReader;
+class QXmlStreamWriter;
 
+/**
+ * @brief Converts profiles of old config versions while they are read.
+ *  The migrated profile is written token by token to an output device,
+ *  the source is parsed only once.
+ */
 class XMLConfigMigration : public QObject
 {
     Q_OBJECT
@@ -31,14 +38,15 @@ class XMLConfigMigration : public QObject
     explicit XMLConfigMigration(QXmlStreamReader *reader, QObject *parent = nullptr);
 
     bool requiresMigration();
-    QString migrate();
+    bool migrate(QIODevice *output);
+
+    static bool migrateFile(const QString &fileName);
 
     const QXmlStreamReader *getReader();
     int getFileVersion() const;
 
   private:
-    QString readConfigToString();
-    QString version0006Migration();
+    void version0006Migration(QXmlStreamWriter *writer);
 
     QXmlStreamReader *reader;
     int fileVersion;
@@ -22,6 +22,8 @@
 #include "globalvariables.h"
 #include "inputdevice.h"
 #include "joystick.h"
+#include "profilecache.h"
+#include "profilepreloader.h"
 #include "xml/inputdevicexml.h"
 #include "xmlconfigmigration.h"
 #include "xmlconfigwriter.h"
@@ -29,9 +31,11 @@
 #include "common.h"
 #include "gamecontroller/gamecontroller.h"
 
+#include <QBuffer>
 #include <QDebug>
 #include <QDir>
 #include <QFile>
+#include <QFileInfo>
 #include <QStringList>
 #include <QXmlStreamReader>
 
@@ -68,10 +72,13 @@ XMLConfigReader::~XMLConfigReader()
 void XMLConfigReader::setJoystick(InputDevice *joystick) { m_joystick = joystick; }
 
 /**
- * @brief Sets the filename of the to be read XML file
+ * @brief Sets the filename of the to be read XML file. Waits until saves
+ *  of that file which are still being written are finished.
  */
 void XMLConfigReader::setFileName(QString filename)
 {
+    XMLConfigWriter::waitForPendingWrites(filename);
+
     QFile *temp = new QFile(filename);
 
     if (temp->exists())
@@ -102,6 +109,34 @@ bool XMLConfigReader::read()
     {
         xml->clear();
 
+        // Fast paths: already migrated profile without comments and indentation,
+        // either preloaded in memory or from the minified cache. It is handed
+        // to the device thread as a whole.
+        QByteArray compiled;
+        ProfileCache profileCache;
+
+        if (ProfilePreloader::lookup(configFile->fileName(), &compiled) || profileCache.open(configFile->fileName()))
+        {
+            if (compiled.isEmpty())
+                compiled = profileCache.payload();
+
+            InputDeviceXml *joystick_xml = new InputDeviceXml(m_joystick);
+            QString applyError = joystick_xml->applyConfig(compiled);
+            joystick_xml->deleteLater();
+            profileCache.close();
+
+            if (applyError.isEmpty())
+                return false;
+
+            WARN() << "Could not read minified profile:" << applyError << "reading" << configFile->fileName();
+            ProfileCache::discard(configFile->fileName());
+        }
+
+        // Migrated profiles replace the file only if it was not saved since.
+        QFileInfo sourceInfo(configFile->fileName());
+        qint64 sourceSize = sourceInfo.size();
+        QDateTime sourceLastModified = sourceInfo.lastModified();
+
         if (!configFile->isOpen())
         {
             if (configFile->open(QFile::ReadOnly | QFile::Text))
@@ -121,54 +156,67 @@ bool XMLConfigReader::read()
 
             if (migration.requiresMigration())
             {
-                QString migrationString = migration.migrate();
+                QByteArray migrated;
+                QBuffer migratedBuffer(&migrated);
+                migratedBuffer.open(QIODevice::WriteOnly);
 
-                if (migrationString.length() > 0)
+                if (migration.migrate(&migratedBuffer))
                 {
-                    xml->clear();                                     // Remove QFile from reader and clear state
-                    xml->addData(migrationString);                    // Add converted XML string to reader
-                    xml->readNextStartElement();                      // Skip joystick root node
-                    configFile->close();                              // Close current config file
-                    configFile->open(QFile::WriteOnly | QFile::Text); // Write converted XML to file
-
-                    if (configFile->isOpen())
-                    {
-                        configFile->write(migrationString.toLocal8Bit());
-                        configFile->close();
-                    } else
-                    {
-                        xml->raiseError(tr("Could not write updated profile XML to file %1.").arg(configFile->fileName()));
-                    }
+                    xml->clear();                // Remove QFile from reader and clear state
+                    xml->addData(migrated);      // Continue with the converted profile
+                    xml->readNextStartElement(); // Move to joystick root node
+                    configFile->close();
+                    XMLConfigWriter::replaceUnmodified(configFile->fileName(), migrated, sourceSize,
+                                                       sourceLastModified);
+                } else
+                {
+                    xml->raiseError(tr("Could not migrate profile %1.").arg(configFile->fileName()));
                 }
             }
         }
 
-        while (!xml->atEnd())
-        {
-            if (xml->isStartElement() && deviceTypes.contains(xml->name().toString()))
-            {
-                InputDeviceXml *joystick_xml = new InputDeviceXml(m_joystick);
-                joystick_xml->readConfig(xml);
-                joystick_xml->deleteLater();
-            } else
-            {
-                // If none of the above, skip the element
-                xml->skipCurrentElement();
-            }
-
-            xml->readNextStartElement();
-        }
+        error = readDevices();
 
         if (configFile->isOpen())
             configFile->close();
 
-        if (xml->hasError() && (xml->error() != QXmlStreamReader::PrematureEndOfDocumentError))
+        if (!error && ProfileCache::isEnabled())
+            ProfileCache::compile(configFile->fileName());
+    }
+
+    return error;
+}
+
+/**
+ * @brief Reads all device elements from the current position of the stream.
+ * @return true on error
+ */
+bool XMLConfigReader::readDevices()
+{
+    bool error = false;
+
+    while (!xml->atEnd())
+    {
+        if (xml->isStartElement() && deviceTypes.contains(xml->name().toString()))
         {
-            error = true;
-        } else if (xml->hasError() && (xml->error() == QXmlStreamReader::PrematureEndOfDocumentError))
+            InputDeviceXml *joystick_xml = new InputDeviceXml(m_joystick);
+            joystick_xml->readConfig(xml);
+            joystick_xml->deleteLater();
+        } else
         {
-            xml->clear();
+            // If none of the above, skip the element
+            xml->skipCurrentElement();
         }
+
+        xml->readNextStartElement();
+    }
+
+    if (xml->hasError() && (xml->error() != QXmlStreamReader::PrematureEndOfDocumentError))
+    {
+        error = true;
+    } else if (xml->hasError() && (xml->error() == QXmlStreamReader::PrematureEndOfDocumentError))
+    {
+        xml->clear();
     }
 
     return error;
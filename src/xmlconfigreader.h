@@ -51,6 +51,7 @@ class XMLConfigReader : public QObject
 
   protected:
     void initDeviceTypes();
+    bool readDevices();
 
   public slots:
     void configJoystick(InputDevice *joystick);
@@ -20,12 +20,30 @@
 
 #include "common.h"
 #include "inputdevice.h"
+#include "logger.h"
 #include "xml/inputdevicexml.h"
 
+#include <QBuffer>
+#include <QCryptographicHash>
 #include <QDebug>
 #include <QDir>
 #include <QFile>
+#include <QFileInfo>
+#include <QFutureWatcher>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSaveFile>
+#include <QThreadPool>
+#include <QWaitCondition>
 #include <QXmlStreamWriter>
+#include <QtConcurrent>
+
+QMutex XMLConfigWriter::writtenProfilesMutex;
+QHash<QString, XMLConfigWriter::WrittenProfile> XMLConfigWriter::writtenProfiles;
+QMutex XMLConfigWriter::pendingWritesMutex;
+QWaitCondition XMLConfigWriter::pendingWritesDone;
+QHash<QString, int> XMLConfigWriter::pendingWrites;
+int XMLConfigWriter::scheduledWrites = 0;
 
 XMLConfigWriter::XMLConfigWriter(QObject *parent)
     : QObject(parent)
@@ -36,6 +54,8 @@ XMLConfigWriter::XMLConfigWriter(QObject *parent)
     m_joystick = nullptr;
     m_joystickXml = nullptr;
     writerError = false;
+    m_running_writes = 0;
+    m_delete_when_finished = false;
 }
 
 XMLConfigWriter::~XMLConfigWriter()
@@ -58,31 +78,252 @@ XMLConfigWriter::~XMLConfigWriter()
 
 /**
  * @brief Write input device config from the current object into XML file
+ *  The config is serialized right away, the file is written in the background.
+ *  If that fails, writeFailed() is emitted in the thread of this object.
  * @param[in] joystickXml InputDeviceXml which gets serialized
  */
 void XMLConfigWriter::write(InputDeviceXml *joystickXml)
 {
-    writerError = false;
+    writerErrorString = checkWritable(fileName);
+    writerError = !writerErrorString.isEmpty();
+
+    if (writerError)
+        return;
+
+    QFileInfo fileInfo(fileName);
+
+    // Line endings are converted here, the file gets the buffer as it is.
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly | QIODevice::Text);
+    xml->setDevice(&buffer);
+
+    xml->writeStartDocument();
+    joystickXml->writeConfig(xml);
+    xml->writeEndDocument();
+
+    xml->setDevice(nullptr);
+
+    // The writer stays alive until the result is known, see deleteWhenFinished().
+    QString target = fileInfo.absoluteFilePath();
+    QFutureWatcher<bool> *watcher = new QFutureWatcher<bool>(this);
+    m_running_writes++;
+    connect(watcher, &QFutureWatcher<bool>::finished, this, [this, watcher, target] {
+        if (!watcher->result())
+            emit writeFailed(target);
+
+        watcher->deleteLater();
+
+        if ((--m_running_writes == 0) && m_delete_when_finished)
+            deleteLater();
+    });
+
+    beginPendingWrite(target);
+    watcher->setFuture(QtConcurrent::run(writerPool(), [target, data] {
+        bool written = writeFile(target, data);
+        endPendingWrite(target);
+        return written;
+    }));
+}
+
+/**
+ * @brief Replaces a file with content derived from it, like a migrated
+ *  profile, on the writer thread. The file is left alone if its size or
+ *  modification time differ from the given ones when the new content is
+ *  committed, since then it was saved again after it was read.
+ */
+void XMLConfigWriter::replaceUnmodified(const QString &fileName, const QByteArray &data, qint64 size,
+                                        const QDateTime &lastModified)
+{
+    QString target = QFileInfo(fileName).absoluteFilePath();
+    beginPendingWrite(target);
+    QtConcurrent::run(writerPool(), [target, data, size, lastModified] {
+        QSaveFile output(target);
+
+        if (!output.open(QFile::WriteOnly | QFile::Text) || (output.write(data) != data.size()))
+        {
+            WARN() << "Could not write updated profile XML to file" << target << ": " << output.errorString();
+        } else
+        {
+            QFileInfo current(target);
+
+            if (!current.exists() || (current.size() != size) || (current.lastModified() != lastModified))
+            {
+                DEBUG() << "Profile " << target << " changed since it was read, skip writing";
+                output.cancelWriting();
+            } else if (!output.commit())
+            {
+                WARN() << "Could not write updated profile XML to file" << target << ": " << output.errorString();
+            }
+        }
+
+        endPendingWrite(target);
+    });
+}
+
+/**
+ * @brief Checks whether the profile can be written. Can be called from any
+ *  thread, e.g. by the GUI before it schedules a save.
+ * @return error message, empty if the file is writable
+ */
+QString XMLConfigWriter::checkWritable(const QString &fileName)
+{
+    QFileInfo fileInfo(fileName);
+
+    if (fileInfo.exists() ? !fileInfo.isWritable() : !QFileInfo(fileInfo.absolutePath()).isWritable())
+        return tr("Could not write to profile at %1.").arg(fileName);
+
+    return QString();
+}
+
+/**
+ * @brief Blocks until all scheduled profile saves are serialized and all
+ *  profile writes are finished. The threads of the devices have to keep
+ *  running meanwhile.
+ */
+void XMLConfigWriter::waitForPendingWrites()
+{
+    {
+        QMutexLocker locker(&pendingWritesMutex);
+
+        while ((scheduledWrites > 0) || !pendingWrites.isEmpty())
+            pendingWritesDone.wait(&pendingWritesMutex);
+    }
+
+    writerPool()->waitForDone();
+}
+
+/**
+ * @brief Deletes the writer once the results of its writes are known, so
+ *  writeFailed() is not lost when the next save replaces the writer.
+ */
+void XMLConfigWriter::deleteWhenFinished()
+{
+    if (m_running_writes == 0)
+        deleteLater();
+    else
+        m_delete_when_finished = true;
+}
+
+XMLConfigWriter::ScheduledWrite::ScheduledWrite()
+{
+    QMutexLocker locker(&pendingWritesMutex);
+    scheduledWrites++;
+}
+
+XMLConfigWriter::ScheduledWrite::~ScheduledWrite()
+{
+    QMutexLocker locker(&pendingWritesMutex);
+    scheduledWrites--;
+    pendingWritesDone.wakeAll();
+}
+
+/**
+ * @brief Blocks until all writes scheduled for the given file are finished.
+ *  Must not be called from the writer thread.
+ */
+void XMLConfigWriter::waitForPendingWrites(const QString &fileName)
+{
+    QString target = QFileInfo(fileName).absoluteFilePath();
+    QMutexLocker locker(&pendingWritesMutex);
+
+    while (pendingWrites.value(target) > 0)
+        pendingWritesDone.wait(&pendingWritesMutex);
+}
+
+void XMLConfigWriter::beginPendingWrite(const QString &fileName)
+{
+    QMutexLocker locker(&pendingWritesMutex);
+    pendingWrites[fileName]++;
+}
+
+void XMLConfigWriter::endPendingWrite(const QString &fileName)
+{
+    QMutexLocker locker(&pendingWritesMutex);
+
+    if (--pendingWrites[fileName] == 0)
+        pendingWrites.remove(fileName);
+
+    pendingWritesDone.wakeAll();
+}
+
+/**
+ * @brief Runs on the writer thread. The data already has the line endings
+ *  of the platform, so the file is not opened in text mode.
+ * @return false if the file could not be written
+ */
+bool XMLConfigWriter::writeFile(const QString &fileName, const QByteArray &data)
+{
+    QByteArray hash = QCryptographicHash::hash(data, QCryptographicHash::Sha1);
 
-    if (!configFile->isOpen())
+    if (isUnchanged(fileName, hash, data.size()))
     {
-        configFile->open(QFile::WriteOnly | QFile::Text);
-        xml->setDevice(configFile);
-    } else
+        DEBUG() << "Profile " << fileName << " is unchanged, skip writing";
+        return true;
+    }
+
+    QSaveFile output(fileName);
+
+    if (!output.open(QFile::WriteOnly) || (output.write(data) != data.size()) || !output.commit())
     {
-        writerError = true;
-        writerErrorString = tr("Could not write to profile at %1.").arg(configFile->fileName());
+        WARN() << "Could not write to profile at " << fileName << ": " << output.errorString();
+        return false;
     }
 
-    if (!writerError)
+    QFileInfo fileInfo(fileName);
+    QMutexLocker locker(&writtenProfilesMutex);
+    writtenProfiles.insert(fileInfo.absoluteFilePath(), WrittenProfile{hash, fileInfo.size(), fileInfo.lastModified()});
+    return true;
+}
+
+/**
+ * @brief Checks whether the file already has the given content. The hash of
+ *  the last write is used as long as the file was not touched since then,
+ *  otherwise the file is hashed if its size matches.
+ */
+bool XMLConfigWriter::isUnchanged(const QString &fileName, const QByteArray &hash, qint64 size)
+{
+    QFileInfo fileInfo(fileName);
+
+    if (!fileInfo.exists() || (fileInfo.size() != size))
+        return false;
+
     {
-        xml->writeStartDocument();
-        joystickXml->writeConfig(xml);
-        xml->writeEndDocument();
+        QMutexLocker locker(&writtenProfilesMutex);
+        auto iter = writtenProfiles.constFind(fileInfo.absoluteFilePath());
+
+        if ((iter != writtenProfiles.constEnd()) && (iter.value().size == size) &&
+            (iter.value().lastModified == fileInfo.lastModified()))
+        {
+            return iter.value().hash == hash;
+        }
     }
 
-    if (configFile->isOpen())
-        configFile->close();
+    QFile current(fileName);
+
+    if (!current.open(QIODevice::ReadOnly))
+        return false;
+
+    QCryptographicHash currentHash(QCryptographicHash::Sha1);
+    currentHash.addData(&current);
+    return currentHash.result() == hash;
+}
+
+/**
+ * @brief Single thread, so writes are applied in the order they were made.
+ *  Pending writes are finished when the pool is destroyed.
+ */
+QThreadPool *XMLConfigWriter::writerPool()
+{
+    static QThreadPool pool;
+    static bool initialized = [] {
+        pool.setMaxThreadCount(1);
+        pool.setExpiryTimeout(-1);
+        return true;
+    }();
+    Q_UNUSED(initialized)
+
+    return &pool;
 }
 
 /**
@@ -19,13 +19,33 @@
 #ifndef XMLCONFIGWRITER_H
 #define XMLCONFIGWRITER_H
 
+#include <QByteArray>
+#include <QDateTime>
+#include <QHash>
 #include <QObject>
 
 class InputDevice;
 class QXmlStreamWriter;
 class InputDeviceXml;
 class QFile;
+class QMutex;
+class QThreadPool;
+class QWaitCondition;
 
+/**
+ * @brief Saves profiles.
+ *
+ * The profile is serialized into memory on the thread of the device, which
+ * acts as a snapshot of the current model. The GUI does not wait for it, it
+ * schedules the save and learns about failures through writeFailed().
+ * Hashing and writing the file
+ * happen on a dedicated writer thread, so saves to the same file are applied
+ * in order. Files are replaced atomically and left untouched when their
+ * content would not change. Migrated profiles are written by the same
+ * thread, so they cannot overtake a save. Readers wait for pending writes
+ * of the file they open, and writeFailed() reports writes which failed
+ * after write() returned.
+ */
 class XMLConfigWriter : public QObject
 {
     Q_OBJECT
@@ -42,10 +62,55 @@ class XMLConfigWriter : public QObject
     const QFile *getConfigFile();
     const InputDevice *getJoystick();
 
+    static QString checkWritable(const QString &fileName);
+    static void waitForPendingWrites();
+    static void waitForPendingWrites(const QString &fileName);
+    static void replaceUnmodified(const QString &fileName, const QByteArray &data, qint64 size,
+                                  const QDateTime &lastModified);
+
+    void deleteWhenFinished();
+
+    /**
+     * @brief Keeps waitForPendingWrites() waiting for a save which is
+     *  scheduled on the thread of a device but not serialized yet.
+     */
+    class ScheduledWrite
+    {
+      public:
+        ScheduledWrite();
+        ~ScheduledWrite();
+
+      private:
+        Q_DISABLE_COPY(ScheduledWrite)
+    };
+
+  signals:
+    void writeFailed(QString fileName);
+
   public slots:
     void write(InputDeviceXml *joystickXml);
 
   private:
+    struct WrittenProfile
+    {
+        QByteArray hash;
+        qint64 size;
+        QDateTime lastModified;
+    };
+
+    static bool writeFile(const QString &fileName, const QByteArray &data);
+    static bool isUnchanged(const QString &fileName, const QByteArray &hash, qint64 size);
+    static QThreadPool *writerPool();
+    static void beginPendingWrite(const QString &fileName);
+    static void endPendingWrite(const QString &fileName);
+
+    static QMutex writtenProfilesMutex;
+    static QHash<QString, WrittenProfile> writtenProfiles;
+    static QMutex pendingWritesMutex;
+    static QWaitCondition pendingWritesDone;
+    static QHash<QString, int> pendingWrites;
+    static int scheduledWrites;
+
     QXmlStreamWriter *xml;
     QString fileName;
     QFile *configFile;
@@ -53,6 +118,8 @@ class XMLConfigWriter : public QObject
     InputDeviceXml *m_joystickXml;
     bool writerError;
     QString writerErrorString;
+    int m_running_writes;
+    bool m_delete_when_finished;
 };
 
 #endif // XMLCONFIGWRITER_H
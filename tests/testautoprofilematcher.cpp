@@ -0,0 +1,270 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "autoprofileinfo.h"
+#include "autoprofilematcher.h"
+
+#include <QFile>
+#include <QRandomGenerator>
+#include <QTemporaryDir>
+#include <QtTest/QtTest>
+
+class TestAutoProfileMatcher : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    void initTestCase();
+    void cleanup();
+
+    void emptyPropertiesNeverMatch();
+    void allPropertiesRequired();
+    void mostSpecificRuleWins();
+    void overlappingPartialTitles();
+    void inactiveRulesIgnored();
+    void sameAsLinearScan();
+
+  private:
+    AutoProfileInfo *addRule(QString uniqueID, QString exe, QString windowClass, QString windowName, bool partial,
+                             bool active = true);
+    QMap<AutoProfileInfo *, int> match(const QString &exe, const QString &windowClass, const QString &windowName) const;
+    QMap<AutoProfileInfo *, int> linearScan(const QString &exe, const QString &windowClass,
+                                            const QString &windowName) const;
+    static QHash<QString, int> highestMatchCounts(const QMap<AutoProfileInfo *, int> &matches);
+
+    QTemporaryDir m_dir;
+    QStringList m_exes;
+    QList<AutoProfileInfo *> m_infos;
+    AutoProfileMatcher m_matcher;
+};
+
+void TestAutoProfileMatcher::initTestCase()
+{
+    QVERIFY(m_dir.isValid());
+
+    // Rules only accept executables which exist.
+    for (int i = 0; i < 3; i++)
+    {
+        QFile file(m_dir.filePath(QString("game%1.exe").arg(i)));
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.close();
+        QVERIFY(file.setPermissions(file.permissions() | QFile::ExeOwner | QFile::ExeUser));
+        m_exes.append(file.fileName());
+    }
+}
+
+void TestAutoProfileMatcher::cleanup()
+{
+    m_matcher.clear();
+    qDeleteAll(m_infos);
+    m_infos.clear();
+}
+
+AutoProfileInfo *TestAutoProfileMatcher::addRule(QString uniqueID, QString exe, QString windowClass, QString windowName,
+                                                 bool partial, bool active)
+{
+    AutoProfileInfo *info = new AutoProfileInfo(uniqueID, "profile.amgp", exe, active, partial, nullptr);
+    info->setWindowClass(windowClass);
+    info->setWindowName(windowName);
+    m_infos.append(info);
+
+    if (active)
+        m_matcher.addRule(info);
+
+    return info;
+}
+
+QMap<AutoProfileInfo *, int> TestAutoProfileMatcher::match(const QString &exe, const QString &windowClass,
+                                                           const QString &windowName) const
+{
+    QMap<AutoProfileInfo *, int> result;
+
+    for (const AutoProfileMatcher::Match &match : m_matcher.match(exe, QFileInfo(exe).fileName(), windowClass, windowName))
+        result.insert(match.info, match.matchedProperties);
+
+    return result;
+}
+
+/**
+ * @brief Scores every rule the way runAppCheck() did before the matcher.
+ */
+QMap<AutoProfileInfo *, int> TestAutoProfileMatcher::linearScan(const QString &exe, const QString &windowClass,
+                                                                const QString &windowName) const
+{
+    QMap<AutoProfileInfo *, int> result;
+    QString baseAppFileName = QFileInfo(exe).fileName();
+
+    for (AutoProfileInfo *info : m_infos)
+    {
+        if (!info->isActive())
+            continue;
+
+        int numProps = 0;
+        numProps += !info->getExe().isEmpty() ? 1 : 0;
+        numProps += !info->getWindowClass().isEmpty() ? 1 : 0;
+        numProps += !info->getWindowName().isEmpty() ? 1 : 0;
+
+        int numMatched = 0;
+        numMatched += (!info->getExe().isEmpty() && (info->getExe() == exe || info->getExe() == baseAppFileName)) ? 1 : 0;
+        numMatched += (!info->getWindowClass().isEmpty() && info->getWindowClass() == windowClass) ? 1 : 0;
+
+        if (info->isPartialState())
+            numMatched += (!info->getWindowName().isEmpty() && windowName.contains(info->getWindowName())) ? 1 : 0;
+        else
+            numMatched += (!info->getWindowName().isEmpty() && info->getWindowName() == windowName) ? 1 : 0;
+
+        if ((numProps > 0) && (numProps == numMatched))
+            result.insert(info, numMatched);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Match count of the rule runAppCheck() picks for each controller.
+ */
+QHash<QString, int> TestAutoProfileMatcher::highestMatchCounts(const QMap<AutoProfileInfo *, int> &matches)
+{
+    QHash<QString, int> result;
+
+    for (auto iter = matches.constBegin(); iter != matches.constEnd(); ++iter)
+    {
+        QString uniqueID = iter.key()->getUniqueID();
+
+        if (!result.contains(uniqueID) || (iter.value() > result.value(uniqueID)))
+            result.insert(uniqueID, iter.value());
+    }
+
+    return result;
+}
+
+void TestAutoProfileMatcher::emptyPropertiesNeverMatch()
+{
+    AutoProfileInfo *titleRule = addRule("all", QString(), QString(), "Editor", true);
+    m_matcher.compile();
+
+    QVERIFY(match(QString(), QString(), QString()).isEmpty());
+    QVERIFY(match(m_exes.at(0), "classA", QString()).isEmpty());
+    QCOMPARE(match(QString(), QString(), "Text Editor").value(titleRule), 1);
+}
+
+void TestAutoProfileMatcher::allPropertiesRequired()
+{
+    AutoProfileInfo *rule = addRule("all", m_exes.at(0), "classA", "Doom", false);
+    m_matcher.compile();
+
+    QCOMPARE(match(m_exes.at(0), "classA", "Doom").value(rule), 3);
+    QVERIFY(match(m_exes.at(0), "classA", "Doom Eternal").isEmpty());
+    QVERIFY(match(m_exes.at(0), "classB", "Doom").isEmpty());
+    QVERIFY(match(m_exes.at(1), "classA", "Doom").isEmpty());
+}
+
+void TestAutoProfileMatcher::mostSpecificRuleWins()
+{
+    addRule("all", m_exes.at(0), QString(), QString(), false);
+    addRule("all", m_exes.at(0), "classA", QString(), false);
+    AutoProfileInfo *best = addRule("all", m_exes.at(0), "classA", "Doom", true);
+    AutoProfileInfo *otherPad = addRule("pad", QString(), "classA", QString(), false);
+    m_matcher.compile();
+
+    QMap<AutoProfileInfo *, int> matches = match(m_exes.at(0), "classA", "Doom Eternal");
+    QCOMPARE(matches.size(), 4);
+
+    QHash<QString, int> highest = highestMatchCounts(matches);
+    QCOMPARE(highest.value("all"), matches.value(best));
+    QCOMPARE(highest.value("pad"), matches.value(otherPad));
+    QCOMPARE(highest.value("all"), 3);
+    QCOMPARE(highest.value("pad"), 1);
+}
+
+void TestAutoProfileMatcher::overlappingPartialTitles()
+{
+    // Classic overlapping patterns which need the failure links.
+    AutoProfileInfo *he = addRule("all", QString(), QString(), "he", true);
+    AutoProfileInfo *she = addRule("all", QString(), QString(), "she", true);
+    AutoProfileInfo *his = addRule("all", QString(), QString(), "his", true);
+    AutoProfileInfo *hers = addRule("all", QString(), QString(), "hers", true);
+    m_matcher.compile();
+
+    QMap<AutoProfileInfo *, int> matches = match(QString(), QString(), "ushers");
+    QVERIFY(matches.contains(he));
+    QVERIFY(matches.contains(she));
+    QVERIFY(matches.contains(hers));
+    QVERIFY(!matches.contains(his));
+    QCOMPARE(matches, linearScan(QString(), QString(), "ushers"));
+}
+
+void TestAutoProfileMatcher::inactiveRulesIgnored()
+{
+    addRule("all", m_exes.at(0), QString(), QString(), false, false);
+    AutoProfileInfo *active = addRule("all", QString(), "classA", QString(), false);
+    m_matcher.compile();
+
+    QMap<AutoProfileInfo *, int> matches = match(m_exes.at(0), "classA", QString());
+    QCOMPARE(matches.size(), 1);
+    QVERIFY(matches.contains(active));
+
+    // Rules deactivated after compiling are skipped as well.
+    active->setActive(false);
+    QVERIFY(match(m_exes.at(0), "classA", QString()).isEmpty());
+}
+
+void TestAutoProfileMatcher::sameAsLinearScan()
+{
+    const QStringList classes = {QString(), "classA", "classB", "classC"};
+    const QStringList titles = {QString(), "Doom", "Doom Eternal", "oom E", "Quake", "Quake Champions", "Champ",
+                                "Editor", "o", "e"};
+    const QStringList uniqueIDs = {"all", "pad1", "pad2"};
+    QRandomGenerator random(20260417);
+
+    auto pick = [&random](const QStringList &list) { return list.at(random.bounded(list.size())); };
+    QStringList exes = m_exes;
+    exes.prepend(QString());
+
+    for (int i = 0; i < 400; i++)
+        addRule(pick(uniqueIDs), pick(exes), pick(classes), pick(titles), random.bounded(2) == 1,
+                random.bounded(10) != 0);
+
+    m_matcher.compile();
+
+    exes.append("/usr/bin/unknown");
+
+    for (int i = 0; i < 500; i++)
+    {
+        QString exe = pick(exes);
+        QString windowClass = pick(classes);
+        QString windowName;
+
+        // Exact titles, titles made of several rule titles and unknown ones.
+        int words = random.bounded(4);
+        for (int word = 0; word < words; word++)
+            windowName += pick(titles) + (random.bounded(2) == 1 ? " " : "");
+
+        if (random.bounded(8) == 0)
+            windowName = "Unknown window";
+
+        QMap<AutoProfileInfo *, int> expected = linearScan(exe, windowClass, windowName);
+        QMap<AutoProfileInfo *, int> actual = match(exe, windowClass, windowName);
+
+        QVERIFY2(actual == expected, qPrintable(QString("Window \"%1\", class \"%2\", program \"%3\"")
+                                                    .arg(windowName, windowClass, exe)));
+        QCOMPARE(highestMatchCounts(actual), highestMatchCounts(expected));
+    }
+}
+
+QTEST_GUILESS_MAIN(TestAutoProfileMatcher)
+#include "testautoprofilematcher.moc"
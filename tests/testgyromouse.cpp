@@ -0,0 +1,198 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _USE_MATH_DEFINES
+
+#include "gyromouse.h"
+
+#include <QtTest/QtTest>
+
+#include <cmath>
+
+class TestGyroMouse : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    void nominalPeriodWithoutTimestamps();
+    void pitchMovesVertically();
+    void timestampGapIntegratesLonger();
+    void longGapIsClamped();
+    void duplicateTimestampAddsNothing();
+    void subpixelCarry();
+    void resetDropsMovement();
+
+  private:
+    static const double RATE;
+
+    static GyroMouse createMouse();
+    static void feed(GyroMouse &mouse, double yawDegrees, double pitchDegrees, quint64 timestampUs = 0);
+};
+
+// With 1 pixel per degree, 100 °/s move the cursor by 1 pixel per sample.
+const double TestGyroMouse::RATE = 100.0;
+
+GyroMouse TestGyroMouse::createMouse()
+{
+    GyroMouse mouse(RATE);
+    mouse.setSensitivity(1.0);
+    mouse.setSpace(GyroMouse::LOCAL_SPACE);
+    mouse.setSmoothing(0);
+    return mouse;
+}
+
+/**
+ * @brief Integrates one sample with the given angular velocities in °/s.
+ *  The curve is bypassed, so the movement is linear.
+ */
+void TestGyroMouse::feed(GyroMouse &mouse, double yawDegrees, double pitchDegrees, quint64 timestampUs)
+{
+    const float angularVelocity[3] = {static_cast<float>(pitchDegrees * M_PI / 180.0),
+                                      static_cast<float>(yawDegrees * M_PI / 180.0), 0.0f};
+    mouse.processSample(angularVelocity, nullptr, 0, timestampUs);
+}
+
+void TestGyroMouse::nominalPeriodWithoutTimestamps()
+{
+    GyroMouse mouse = createMouse();
+    int dx = 0;
+    int dy = 0;
+
+    for (int i = 0; i < 10; i++)
+        feed(mouse, 100.0, 0.0);
+
+    // Positive yaw turns left.
+    QVERIFY(mouse.takeDelta(&dx, &dy));
+    QCOMPARE(dx, -10);
+    QCOMPARE(dy, 0);
+    QVERIFY(!mouse.takeDelta(&dx, &dy));
+}
+
+void TestGyroMouse::pitchMovesVertically()
+{
+    GyroMouse mouse = createMouse();
+    int dx = 0;
+    int dy = 0;
+
+    for (int i = 0; i < 3; i++)
+        feed(mouse, 0.0, -200.0);
+
+    // Negative pitch tilts down.
+    QVERIFY(mouse.takeDelta(&dx, &dy));
+    QCOMPARE(dx, 0);
+    QCOMPARE(dy, 6);
+}
+
+void TestGyroMouse::timestampGapIntegratesLonger()
+{
+    GyroMouse mouse = createMouse();
+    int dx = 0;
+    int dy = 0;
+
+    // The first sample has no predecessor and uses the nominal period.
+    feed(mouse, 100.0, 0.0, 10000);
+    feed(mouse, 100.0, 0.0, 20000);
+    // One sample was dropped in between.
+    feed(mouse, 100.0, 0.0, 40000);
+    // Samples arriving faster than the nominal rate add less.
+    feed(mouse, 100.0, 0.0, 45000);
+
+    QVERIFY(mouse.takeDelta(&dx, &dy));
+    QCOMPARE(dx, -4);
+    QVERIFY(!mouse.takeDelta(&dx, &dy));
+
+    feed(mouse, 100.0, 0.0, 50000);
+    QVERIFY(mouse.takeDelta(&dx, &dy));
+    QCOMPARE(dx, -1);
+}
+
+void TestGyroMouse::longGapIsClamped()
+{
+    GyroMouse mouse = createMouse();
+    int dx = 0;
+    int dy = 0;
+
+    feed(mouse, 100.0, 0.0, 10000);
+    // One second without samples is integrated over 4 periods only.
+    feed(mouse, 100.0, 0.0, 1010000);
+
+    QVERIFY(mouse.takeDelta(&dx, &dy));
+    QCOMPARE(dx, -5);
+}
+
+void TestGyroMouse::duplicateTimestampAddsNothing()
+{
+    GyroMouse mouse = createMouse();
+    int dx = 0;
+    int dy = 0;
+
+    feed(mouse, 100.0, 0.0, 10000);
+    feed(mouse, 100.0, 0.0, 10000);
+    feed(mouse, 100.0, 0.0, 10000);
+
+    QVERIFY(mouse.takeDelta(&dx, &dy));
+    QCOMPARE(dx, -1);
+}
+
+void TestGyroMouse::subpixelCarry()
+{
+    GyroMouse mouse = createMouse();
+    int dx = 0;
+    int dy = 0;
+
+    // A quarter pixel per sample.
+    for (int i = 0; i < 3; i++)
+    {
+        feed(mouse, -25.0, 25.0);
+        QVERIFY(!mouse.takeDelta(&dx, &dy));
+        QCOMPARE(dx, 0);
+        QCOMPARE(dy, 0);
+    }
+
+    feed(mouse, -25.0, 25.0);
+    QVERIFY(mouse.takeDelta(&dx, &dy));
+    QCOMPARE(dx, 1);
+    QCOMPARE(dy, -1);
+
+    // Fractions in opposite directions cancel out.
+    feed(mouse, 50.0, 0.0);
+    feed(mouse, -50.0, 0.0);
+    QVERIFY(!mouse.takeDelta(&dx, &dy));
+}
+
+void TestGyroMouse::resetDropsMovement()
+{
+    GyroMouse mouse = createMouse();
+    int dx = 0;
+    int dy = 0;
+
+    feed(mouse, 75.0, 0.0, 10000);
+    feed(mouse, 300.0, 0.0, 20000);
+    mouse.reset();
+
+    QVERIFY(!mouse.takeDelta(&dx, &dy));
+
+    // The previous timestamp is forgotten as well.
+    feed(mouse, 75.0, 0.0, 500000);
+    QVERIFY(!mouse.takeDelta(&dx, &dy));
+    feed(mouse, 25.0, 0.0, 510000);
+    QVERIFY(mouse.takeDelta(&dx, &dy));
+    QCOMPARE(dx, -1);
+}
+
+QTEST_GUILESS_MAIN(TestGyroMouse)
+#include "testgyromouse.moc"
@@ -0,0 +1,183 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mousehistory.h"
+
+#include <QtTest/QtTest>
+
+class TestMouseHistory : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    void emptyHistory();
+    void partialWindow();
+    void averageAfterWraparound_data();
+    void averageAfterWraparound();
+    void weightModifierChange();
+    void fillWithZeros();
+    void setSizeClears();
+
+  private:
+    static double expectedAverage(const QList<double> &newestFirst, double weightModifier);
+    static double sampleValue(int index);
+};
+
+/**
+ * @brief Weighted average computed from scratch, the newest value first.
+ */
+double TestMouseHistory::expectedAverage(const QList<double> &newestFirst, double weightModifier)
+{
+    double sum = 0.0;
+    double weightTotal = 0.0;
+    double weight = 1.0;
+
+    for (double value : newestFirst)
+    {
+        sum += value * weight;
+        weightTotal += weight;
+        weight *= weightModifier;
+    }
+
+    return (weightTotal > 0.0) ? sum / weightTotal : 0.0;
+}
+
+double TestMouseHistory::sampleValue(int index) { return ((index * 37) % 23) - 11.5 + index * 0.01; }
+
+void TestMouseHistory::emptyHistory()
+{
+    MouseHistory history;
+    history.setSize(10);
+
+    QCOMPARE(history.count(), 0);
+    QCOMPARE(history.weightedAverage(), 0.0);
+}
+
+void TestMouseHistory::partialWindow()
+{
+    MouseHistory history;
+    history.setSize(5);
+
+    history.push(4.0, 0.5);
+    history.push(2.0, 0.5);
+    history.push(1.0, 0.5);
+
+    QCOMPARE(history.count(), 3);
+    QCOMPARE(history.at(0), 1.0);
+    QCOMPARE(history.at(2), 4.0);
+    // (1 + 2 * 0.5 + 4 * 0.25) / (1 + 0.5 + 0.25)
+    QVERIFY(qAbs(history.weightedAverage() - 3.0 / 1.75) < 1e-12);
+}
+
+void TestMouseHistory::averageAfterWraparound_data()
+{
+    QTest::addColumn<int>("size");
+    QTest::addColumn<double>("weightModifier");
+
+    QTest::newRow("small window") << 10 << 0.2;
+    QTest::newRow("no weighting") << 7 << 1.0;
+    QTest::newRow("full capacity") << MouseHistory::CAPACITY << 0.9;
+}
+
+void TestMouseHistory::averageAfterWraparound()
+{
+    QFETCH(int, size);
+    QFETCH(double, weightModifier);
+
+    MouseHistory history;
+    history.setSize(size);
+    QList<double> reference;
+
+    // The window and the ring buffer both wrap several times, and the sum is
+    // recomputed in between.
+    for (int i = 0; i < MouseHistory::CAPACITY * 3 + 17; i++)
+    {
+        double value = sampleValue(i);
+        history.push(value, weightModifier);
+        reference.prepend(value);
+
+        if (reference.size() > size)
+            reference.removeLast();
+
+        QCOMPARE(history.count(), reference.size());
+        QCOMPARE(history.at(reference.size() - 1), reference.last());
+
+        double expected = expectedAverage(reference, weightModifier);
+        QVERIFY2(qAbs(history.weightedAverage() - expected) < 1e-9,
+                 qPrintable(QString("push %1: %2 instead of %3").arg(i).arg(history.weightedAverage()).arg(expected)));
+    }
+}
+
+void TestMouseHistory::weightModifierChange()
+{
+    MouseHistory history;
+    history.setSize(20);
+    QList<double> reference;
+
+    for (int i = 0; i < 45; i++)
+    {
+        history.push(sampleValue(i), 0.3);
+        reference.prepend(sampleValue(i));
+    }
+
+    reference = reference.mid(0, 20);
+    QVERIFY(qAbs(history.weightedAverage() - expectedAverage(reference, 0.3)) < 1e-9);
+
+    // All values in the window are weighted with the new modifier.
+    history.push(5.0, 0.8);
+    reference.prepend(5.0);
+    reference.removeLast();
+    QVERIFY(qAbs(history.weightedAverage() - expectedAverage(reference, 0.8)) < 1e-9);
+}
+
+void TestMouseHistory::fillWithZeros()
+{
+    MouseHistory history;
+    history.setSize(4);
+
+    for (int i = 0; i < 10; i++)
+        history.push(sampleValue(i), 0.5);
+
+    history.fillWithZeros(0.5);
+    QCOMPARE(history.count(), 4);
+    QCOMPARE(history.weightedAverage(), 0.0);
+
+    // Zeros count as full window, so one value is averaged with them.
+    history.push(8.0, 0.5);
+    QVERIFY(qAbs(history.weightedAverage() - expectedAverage({8.0, 0.0, 0.0, 0.0}, 0.5)) < 1e-12);
+}
+
+void TestMouseHistory::setSizeClears()
+{
+    MouseHistory history;
+    history.setSize(3);
+    history.push(1.0, 0.5);
+    history.push(2.0, 0.5);
+
+    history.setSize(6);
+    QCOMPARE(history.size(), 6);
+    QCOMPARE(history.count(), 0);
+    QCOMPARE(history.weightedAverage(), 0.0);
+
+    // Sizes out of range are ignored.
+    history.setSize(0);
+    history.setSize(MouseHistory::CAPACITY + 1);
+    QCOMPARE(history.size(), 6);
+}
+
+QTEST_GUILESS_MAIN(TestMouseHistory)
+#include "testmousehistory.moc"
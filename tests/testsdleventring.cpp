@@ -0,0 +1,154 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "sdleventring.h"
+
+#include <SDL2/SDL.h>
+
+#include <QtTest/QtTest>
+
+class TestSDLEventRing : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void retainKeepsOrder();
+    void retainAfterWrap();
+    void retainModifiesEvents();
+    void enqueueOverflow();
+    void fetchOverflow();
+
+  private:
+    static SDL_Event userEvent(int code);
+    static QList<int> codes(SDLEventRing *ring);
+};
+
+void TestSDLEventRing::initTestCase() { QVERIFY2(SDL_Init(SDL_INIT_EVENTS) == 0, SDL_GetError()); }
+
+void TestSDLEventRing::cleanupTestCase() { SDL_Quit(); }
+
+SDL_Event TestSDLEventRing::userEvent(int code)
+{
+    SDL_Event event;
+    SDL_memset(&event, 0, sizeof(event));
+    event.type = SDL_USEREVENT;
+    event.user.code = code;
+    return event;
+}
+
+QList<int> TestSDLEventRing::codes(SDLEventRing *ring)
+{
+    QList<int> result;
+    SDL_Event event;
+
+    while (ring->dequeue(event))
+        result.append(event.user.code);
+
+    return result;
+}
+
+void TestSDLEventRing::retainKeepsOrder()
+{
+    SDLEventRing ring(8);
+
+    for (int i = 0; i < 8; i++)
+        QVERIFY(ring.enqueue(userEvent(i)));
+
+    ring.retainIf([](SDL_Event &event) { return (event.user.code % 2) == 0; });
+
+    QCOMPARE(ring.size(), 4);
+    QCOMPARE(codes(&ring), QList<int>({0, 2, 4, 6}));
+}
+
+void TestSDLEventRing::retainAfterWrap()
+{
+    SDLEventRing ring(4);
+    SDL_Event event;
+
+    QVERIFY(ring.enqueue(userEvent(0)));
+    QVERIFY(ring.enqueue(userEvent(1)));
+    QVERIFY(ring.enqueue(userEvent(2)));
+    QVERIFY(ring.dequeue(event));
+    QVERIFY(ring.dequeue(event));
+
+    // Head is at index 2, the new events wrap around the end of the storage.
+    QVERIFY(ring.enqueue(userEvent(3)));
+    QVERIFY(ring.enqueue(userEvent(4)));
+    QVERIFY(ring.enqueue(userEvent(5)));
+    QVERIFY(ring.isFull());
+
+    ring.retainIf([](SDL_Event &event) { return event.user.code != 3; });
+
+    QCOMPARE(ring.size(), 3);
+    QVERIFY(ring.enqueue(userEvent(6)));
+    QCOMPARE(codes(&ring), QList<int>({2, 4, 5, 6}));
+}
+
+void TestSDLEventRing::retainModifiesEvents()
+{
+    SDLEventRing ring(4);
+
+    for (int i = 0; i < 3; i++)
+        QVERIFY(ring.enqueue(userEvent(i)));
+
+    ring.retainIf([](SDL_Event &event) {
+        event.user.code += 10;
+        return true;
+    });
+
+    QCOMPARE(codes(&ring), QList<int>({10, 11, 12}));
+}
+
+void TestSDLEventRing::enqueueOverflow()
+{
+    SDLEventRing ring(2);
+
+    QVERIFY(ring.enqueue(userEvent(0)));
+    QVERIFY(ring.enqueue(userEvent(1)));
+    QVERIFY(!ring.enqueue(userEvent(2)));
+
+    QCOMPARE(ring.getOverflowCount(), quint64(1));
+    QCOMPARE(codes(&ring), QList<int>({0, 1}));
+}
+
+void TestSDLEventRing::fetchOverflow()
+{
+    SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+    for (int i = 0; i < 5; i++)
+    {
+        SDL_Event event = userEvent(i);
+        QVERIFY(SDL_PushEvent(&event) == 1);
+    }
+
+    SDLEventRing ring(3);
+
+    // Events which do not fit stay in the SDL queue for the next cycle.
+    QCOMPARE(ring.fetchFromSDL(), 3);
+    QCOMPARE(ring.getOverflowCount(), quint64(1));
+    QCOMPARE(codes(&ring), QList<int>({0, 1, 2}));
+
+    QCOMPARE(ring.fetchFromSDL(), 2);
+    QCOMPARE(ring.getOverflowCount(), quint64(1));
+    QCOMPARE(codes(&ring), QList<int>({3, 4}));
+}
+
+QTEST_GUILESS_MAIN(TestSDLEventRing)
+#include "testsdleventring.moc"
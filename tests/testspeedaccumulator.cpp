@@ -0,0 +1,114 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "speedaccumulator.h"
+
+#include <QtTest/QtTest>
+
+class TestSpeedAccumulator : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    void appendKeepsOrder();
+    void overflowDropsOldest();
+    void clearKeepsOverflowCount();
+    void findLastReturnsNewest();
+
+  private:
+    template <int Capacity> static QList<int> values(const SpeedAccumulator<int, Capacity> &accumulator);
+};
+
+template <int Capacity> QList<int> TestSpeedAccumulator::values(const SpeedAccumulator<int, Capacity> &accumulator)
+{
+    QList<int> result;
+
+    for (int i = 0; i < accumulator.length(); i++)
+        result.append(accumulator.at(i));
+
+    return result;
+}
+
+void TestSpeedAccumulator::appendKeepsOrder()
+{
+    SpeedAccumulator<int, 4> accumulator;
+
+    QVERIFY(accumulator.isEmpty());
+    QVERIFY(accumulator.append(1));
+    QVERIFY(accumulator.append(2));
+    QVERIFY(accumulator.append(3));
+
+    QCOMPARE(accumulator.length(), 3);
+    QCOMPARE(values(accumulator), QList<int>({1, 2, 3}));
+    QCOMPARE(accumulator.getOverflowCount(), quint64(0));
+}
+
+void TestSpeedAccumulator::overflowDropsOldest()
+{
+    SpeedAccumulator<int, 4> accumulator;
+
+    for (int i = 0; i < 4; i++)
+        QVERIFY(accumulator.append(i));
+
+    QVERIFY(!accumulator.append(4));
+    QVERIFY(!accumulator.append(5));
+
+    QCOMPARE(accumulator.length(), 4);
+    QCOMPARE(values(accumulator), QList<int>({2, 3, 4, 5}));
+    QCOMPARE(accumulator.getOverflowCount(), quint64(2));
+
+    // Indexes stay relative to the oldest entry after it moved.
+    accumulator[0] = 20;
+    QCOMPARE(accumulator.at(0), 20);
+    QCOMPARE(values(accumulator), QList<int>({20, 3, 4, 5}));
+}
+
+void TestSpeedAccumulator::clearKeepsOverflowCount()
+{
+    SpeedAccumulator<int, 2> accumulator;
+
+    accumulator.append(1);
+    accumulator.append(2);
+    accumulator.append(3);
+    accumulator.clear();
+
+    QVERIFY(accumulator.isEmpty());
+    QCOMPARE(accumulator.getOverflowCount(), quint64(1));
+
+    QVERIFY(accumulator.append(4));
+    QVERIFY(accumulator.append(5));
+    QCOMPARE(values(accumulator), QList<int>({4, 5}));
+    QCOMPARE(accumulator.getOverflowCount(), quint64(1));
+}
+
+void TestSpeedAccumulator::findLastReturnsNewest()
+{
+    SpeedAccumulator<int, 4> accumulator;
+
+    for (int i = 1; i <= 6; i++)
+        accumulator.append(i);
+
+    int *even = accumulator.findLast([](int value) { return (value % 2) == 0; });
+    QVERIFY(even != nullptr);
+    QCOMPARE(*even, 6);
+
+    // Dropped entries are not found.
+    QVERIFY(accumulator.findLast([](int value) { return value == 1; }) == nullptr);
+}
+
+QTEST_GUILESS_MAIN(TestSpeedAccumulator)
+#include "testspeedaccumulator.moc"
@@ -0,0 +1,154 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "spscqueue.h"
+
+#include <QThread>
+#include <QtTest/QtTest>
+
+class TestSPSCQueue : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    void capacityRoundedUp();
+    void emptyQueue();
+    void fullQueue();
+    void wrapAround();
+    void clearDropsEvents();
+    void producerConsumerThreads();
+};
+
+void TestSPSCQueue::capacityRoundedUp()
+{
+    QCOMPARE(SPSCQueue<int>(1).capacity(), size_t(1));
+    QCOMPARE(SPSCQueue<int>(5).capacity(), size_t(8));
+    QCOMPARE(SPSCQueue<int>(64).capacity(), size_t(64));
+}
+
+void TestSPSCQueue::emptyQueue()
+{
+    SPSCQueue<int> queue(4);
+    int value = -1;
+
+    QVERIFY(queue.isEmpty());
+    QCOMPARE(queue.freeSpace(), size_t(4));
+    QVERIFY(!queue.pop(value));
+    QCOMPARE(value, -1);
+
+    QVERIFY(queue.push(1));
+    QVERIFY(queue.pop(value));
+    QCOMPARE(value, 1);
+    QVERIFY(queue.isEmpty());
+    QVERIFY(!queue.pop(value));
+}
+
+void TestSPSCQueue::fullQueue()
+{
+    SPSCQueue<int> queue(4);
+    int value = 0;
+
+    for (int i = 0; i < 4; i++)
+        QVERIFY(queue.push(i));
+
+    QCOMPARE(queue.freeSpace(), size_t(0));
+    QVERIFY(!queue.push(4));
+
+    // A full queue accepts values again once one was taken.
+    QVERIFY(queue.pop(value));
+    QCOMPARE(value, 0);
+    QCOMPARE(queue.freeSpace(), size_t(1));
+    QVERIFY(queue.push(4));
+    QVERIFY(!queue.push(5));
+}
+
+void TestSPSCQueue::wrapAround()
+{
+    SPSCQueue<int> queue(4);
+    int value = 0;
+    int next = 0;
+
+    // Indexes pass the end of the storage many times.
+    for (int round = 0; round < 10; round++)
+    {
+        for (int i = 0; i < 3; i++)
+            QVERIFY(queue.push(round * 3 + i));
+
+        for (int i = 0; i < 3; i++)
+        {
+            QVERIFY(queue.pop(value));
+            QCOMPARE(value, next++);
+        }
+    }
+
+    QVERIFY(queue.isEmpty());
+}
+
+void TestSPSCQueue::clearDropsEvents()
+{
+    SPSCQueue<int> queue(4);
+    int value = 0;
+
+    QVERIFY(queue.push(1));
+    QVERIFY(queue.push(2));
+    queue.clear();
+
+    QVERIFY(queue.isEmpty());
+    QCOMPARE(queue.freeSpace(), size_t(4));
+    QVERIFY(!queue.pop(value));
+}
+
+void TestSPSCQueue::producerConsumerThreads()
+{
+    const int count = 200000;
+    SPSCQueue<int> queue(64);
+
+    QThread *producer = QThread::create([&queue] {
+        for (int i = 0; i < count; i++)
+        {
+            while (!queue.push(i))
+                QThread::yieldCurrentThread();
+        }
+    });
+    producer->start();
+
+    int expected = 0;
+    int value = 0;
+
+    while (expected < count)
+    {
+        if (queue.pop(value))
+        {
+            if (value != expected)
+                break;
+
+            expected++;
+        } else
+        {
+            QThread::yieldCurrentThread();
+        }
+    }
+
+    producer->wait();
+    delete producer;
+
+    QCOMPARE(expected, count);
+    QVERIFY(queue.isEmpty());
+}
+
+QTEST_GUILESS_MAIN(TestSPSCQueue)
+#include "testspscqueue.moc"
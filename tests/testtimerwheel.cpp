@@ -0,0 +1,205 @@
+/* antimicrox Gamepad to KB+M event mapper
+ * Copyright (C) 2026 AntiMicroX contributors
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "timerwheel.h"
+
+#include <QElapsedTimer>
+#include <QtTest/QtTest>
+
+/**
+ * @brief Receiver of one WheelTimer. Records when and in which order it
+ *  fired and can stop another timer from its callback.
+ */
+class TimerProbe
+{
+  public:
+    TimerProbe(int id, QList<int> *order)
+        : m_id(id)
+        , m_order(order)
+        , m_fired(0)
+        , m_fired_at(-1)
+        , m_stop_on_timeout(nullptr)
+    {
+        m_timer.setCallback<TimerProbe, &TimerProbe::timeout>(this);
+        m_timer.setSingleShot(true);
+        m_clock.start();
+    }
+
+    void start(int msec)
+    {
+        m_clock.restart();
+        m_timer.start(msec);
+    }
+
+    void timeout()
+    {
+        m_fired++;
+        m_fired_at = m_clock.elapsed();
+
+        if (m_order != nullptr)
+            m_order->append(m_id);
+
+        if (m_stop_on_timeout != nullptr)
+            m_stop_on_timeout->stop();
+    }
+
+    WheelTimer m_timer;
+    int m_id;
+    QList<int> *m_order;
+    int m_fired;
+    qint64 m_fired_at;
+    WheelTimer *m_stop_on_timeout;
+    QElapsedTimer m_clock;
+};
+
+class TestTimerWheel : public QObject
+{
+    Q_OBJECT
+
+  private slots:
+    void singleShotFires();
+    void cascadedTimerFiresOnTime();
+    void timersFireInDeadlineOrder();
+    void stopCancelsTimer();
+    void stopCancelsCascadedTimer();
+    void stopFromCallback();
+    void restartReschedules();
+    void repeatingTimer();
+};
+
+void TestTimerWheel::singleShotFires()
+{
+    TimerProbe probe(0, nullptr);
+    probe.start(10);
+
+    QVERIFY(probe.m_timer.isActive());
+    QTRY_COMPARE(probe.m_fired, 1);
+    QVERIFY(!probe.m_timer.isActive());
+    QCOMPARE(TimerWheel::getInstance()->getActiveCount(), 0);
+}
+
+void TestTimerWheel::cascadedTimerFiresOnTime()
+{
+    // 64 ms and more are kept in the second level, 4096 ms and more in the
+    // third one. Both are cascaded down before they fire.
+    TimerProbe second(0, nullptr);
+    TimerProbe third(1, nullptr);
+    second.start(150);
+    third.start(4200);
+
+    QTRY_COMPARE_WITH_TIMEOUT(second.m_fired, 1, 1000);
+    QVERIFY(second.m_fired_at >= 149);
+    QCOMPARE(third.m_fired, 0);
+
+    QTRY_COMPARE_WITH_TIMEOUT(third.m_fired, 1, 6000);
+    QVERIFY(third.m_fired_at >= 4199);
+    QCOMPARE(TimerWheel::getInstance()->getActiveCount(), 0);
+}
+
+void TestTimerWheel::timersFireInDeadlineOrder()
+{
+    QList<int> order;
+    TimerProbe late(0, &order);
+    TimerProbe early(1, &order);
+    TimerProbe middle(2, &order);
+
+    late.start(260);
+    early.start(20);
+    middle.start(90);
+
+    QTRY_COMPARE_WITH_TIMEOUT(order.size(), 3, 2000);
+    QCOMPARE(order, QList<int>({1, 2, 0}));
+}
+
+void TestTimerWheel::stopCancelsTimer()
+{
+    TimerProbe probe(0, nullptr);
+    probe.start(30);
+    probe.m_timer.stop();
+
+    QVERIFY(!probe.m_timer.isActive());
+    QCOMPARE(TimerWheel::getInstance()->getActiveCount(), 0);
+
+    QTest::qWait(80);
+    QCOMPARE(probe.m_fired, 0);
+}
+
+void TestTimerWheel::stopCancelsCascadedTimer()
+{
+    TimerProbe cancelled(0, nullptr);
+    TimerProbe kept(1, nullptr);
+    cancelled.start(200);
+    kept.start(200);
+
+    // Let the wheel run for a while so both are in an upper level slot.
+    QTest::qWait(50);
+    cancelled.m_timer.stop();
+
+    QTRY_COMPARE_WITH_TIMEOUT(kept.m_fired, 1, 1000);
+    QCOMPARE(cancelled.m_fired, 0);
+    QCOMPARE(TimerWheel::getInstance()->getActiveCount(), 0);
+}
+
+void TestTimerWheel::stopFromCallback()
+{
+    QList<int> order;
+    TimerProbe first(0, &order);
+    TimerProbe second(1, &order);
+    first.m_stop_on_timeout = &second.m_timer;
+    second.m_stop_on_timeout = &first.m_timer;
+
+    // Same deadline, the one fired first cancels the other one.
+    first.start(25);
+    second.start(25);
+
+    QTRY_COMPARE(order.size(), 1);
+    QTest::qWait(50);
+    QCOMPARE(order.size(), 1);
+    QCOMPARE(TimerWheel::getInstance()->getActiveCount(), 0);
+}
+
+void TestTimerWheel::restartReschedules()
+{
+    TimerProbe probe(0, nullptr);
+    probe.start(40);
+
+    QTest::qWait(20);
+    probe.start(100);
+
+    QTRY_COMPARE_WITH_TIMEOUT(probe.m_fired, 1, 1000);
+    QVERIFY(probe.m_fired_at >= 99);
+}
+
+void TestTimerWheel::repeatingTimer()
+{
+    TimerProbe probe(0, nullptr);
+    probe.m_timer.setSingleShot(false);
+    probe.start(15);
+
+    QTRY_VERIFY(probe.m_fired >= 3);
+    QVERIFY(probe.m_timer.isActive());
+
+    probe.m_timer.stop();
+    int fired = probe.m_fired;
+
+    QTest::qWait(50);
+    QCOMPARE(probe.m_fired, fired);
+    QCOMPARE(TimerWheel::getInstance()->getActiveCount(), 0);
+}
+
+QTEST_GUILESS_MAIN(TestTimerWheel)
+#include "testtimerwheel.moc"